@@ -0,0 +1,95 @@
+// Copyright 2026 Weicheng Pei
+
+#ifndef BENCH_ABC_BENCH_QUEUE_H_
+#define BENCH_ABC_BENCH_QUEUE_H_
+
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <cstdint>
+#include <mutex>  // NOLINT
+#include <optional>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/forward_list.h"
+#include "benchmark/benchmark.h"
+
+namespace abc {
+namespace bench {
+
+// The baseline: a forward_list used as a FIFO queue under a mutex, which
+// allocates a node per element.
+template <class T>
+class LockedQueue {
+  std::mutex mutex_;
+  abc::forward_list<T> list_;
+  typename abc::forward_list<T>::iterator back_{list_.before_begin()};
+
+ public:
+  explicit LockedQueue(std::size_t) {}
+  bool try_push(const T &value) {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    back_ = list_.emplace_after(back_, value);
+    return true;
+  }
+  std::optional<T> try_pop() {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    if (list_.empty()) {
+      return std::nullopt;
+    }
+    auto value = std::optional<T>(list_.front());
+    list_.pop_front();
+    if (list_.empty()) {
+      back_ = list_.before_begin();
+    }
+    return value;
+  }
+};
+
+// The time stamp carried by each element, to measure its latency.
+inline int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Push `value`, yielding to the consumers while the queue is full.
+template <class Queue, class T>
+void Push(Queue *queue, const T &value) {
+  while (!queue->try_push(value)) {
+    std::this_thread::yield();
+  }
+}
+// Pop a value, yielding to the producers while the queue is empty.
+template <class Queue>
+auto Pop(Queue *queue) {
+  auto value = queue->try_pop();
+  while (!value) {
+    std::this_thread::yield();
+    value = queue->try_pop();
+  }
+  return *value;
+}
+
+// Report the median and the 99th percentile of the `latencies` seen by one
+// consumer.  Counters are averaged over all threads, but only the `1 / share`
+// of them that consume report, so their values are scaled by `share`.
+inline void ReportLatency(benchmark::State &state,
+                          std::vector<int64_t> *latencies, int share) {
+  if (latencies->empty()) {
+    return;
+  }
+  auto percentile = [latencies](double q) {
+    auto nth = latencies->begin() + int64_t(q * (latencies->size() - 1));
+    std::nth_element(latencies->begin(), nth, latencies->end());
+    return static_cast<double>(*nth);
+  };
+  constexpr auto kAvg = benchmark::Counter::kAvgThreads;
+  state.counters["p50_ns"] = benchmark::Counter(share * percentile(0.5), kAvg);
+  state.counters["p99_ns"] = benchmark::Counter(share * percentile(0.99),
+                                                kAvg);
+}
+
+}  // namespace bench
+}  // namespace abc
+
+#endif  // BENCH_ABC_BENCH_QUEUE_H_
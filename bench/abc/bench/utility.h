@@ -0,0 +1,47 @@
+// Copyright 2026 Weicheng Pei
+
+#ifndef BENCH_ABC_BENCH_UTILITY_H_
+#define BENCH_ABC_BENCH_UTILITY_H_
+
+#include <cstdint>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+
+// The largest container size to be swept, overridden by CMake:
+#ifndef ABC_BENCH_MAX_SIZE
+#define ABC_BENCH_MAX_SIZE 100000000
+#endif
+
+namespace abc {
+namespace bench {
+
+// Each element of a non-trivial type owns a heap block, so stop earlier.
+template <class T>
+constexpr int64_t MaxSize() {
+  return std::is_trivially_copyable_v<T> ? ABC_BENCH_MAX_SIZE
+                                         : ABC_BENCH_MAX_SIZE / 100;
+}
+
+// Sweep sizes from 8 to `MaxSize<T>()` and warm up before measuring.
+template <class Container>
+void Configure(benchmark::internal::Benchmark *b) {
+  using T = typename Container::value_type;
+  b->RangeMultiplier(8)->Range(8, MaxSize<T>());
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+
+// Reduce an element to an `int`, so that iterations cannot be optimized out.
+inline int Value(int x) { return x; }
+template <class T>
+int Value(const T &x) { return x.Id(); }
+
+}  // namespace bench
+}  // namespace abc
+
+// Register `Function<Container>` with the common configuration.
+#define ABC_BENCH(Function, Container) \
+  BENCHMARK_TEMPLATE(Function, Container)->Apply( \
+      abc::bench::Configure<Container>)
+
+#endif  // BENCH_ABC_BENCH_UTILITY_H_
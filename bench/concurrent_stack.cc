@@ -0,0 +1,44 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/concurrent_stack.h"
+
+#include <mutex>  // NOLINT
+#include <optional>
+
+#include "abc/forward_list.h"
+#include "benchmark/benchmark.h"
+
+// The baseline: a forward_list used as a stack under a mutex.
+class LockedStack {
+  std::mutex mutex_;
+  abc::forward_list<int> list_;
+
+ public:
+  void push(int value) {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    list_.emplace_front(value);
+  }
+  std::optional<int> try_pop() {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    if (list_.empty()) {
+      return std::nullopt;
+    }
+    auto value = std::optional<int>(list_.front());
+    list_.pop_front();
+    return value;
+  }
+};
+
+// Each thread pushes and then pops, so all threads contend for the top.
+template <class Stack>
+void PushPop(benchmark::State &state) {
+  static Stack stack;
+  for (auto _ : state) {
+    stack.push(state.thread_index());
+    benchmark::DoNotOptimize(stack.try_pop());
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(PushPop, LockedStack)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, abc::concurrent_stack<int>)
+    ->ThreadRange(1, 64)->UseRealTime();
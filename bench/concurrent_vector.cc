@@ -0,0 +1,40 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/concurrent_vector.h"
+
+#include <mutex>  // NOLINT
+
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+// The baseline: an abc::vector appended to under a mutex.
+class LockedVector {
+  std::mutex mutex_;
+  abc::vector<int> vector_;
+
+ public:
+  void push_back(int value) {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    vector_.push_back(value);
+  }
+};
+
+// All threads append to one vector, made and destroyed by the first thread
+// while the others wait outside the loop.
+template <class Vector>
+void PushBack(benchmark::State &state) {
+  static Vector *v;
+  if (state.thread_index() == 0) {
+    v = new Vector;
+  }
+  for (auto _ : state) {
+    v->push_back(state.thread_index());
+  }
+  if (state.thread_index() == 0) {
+    delete v;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(PushBack, LockedVector)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(PushBack, abc::concurrent_vector<int>)
+    ->ThreadRange(1, 64)->UseRealTime();
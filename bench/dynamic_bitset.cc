@@ -0,0 +1,119 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/dynamic_bitset.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "abc/bench/utility.h"
+#include "abc/simd.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+using Bits = abc::dynamic_bitset<>;
+using Bytes = abc::vector<bool>;  // one byte per bit
+using StdBits = std::vector<bool>;
+
+// Return `n` random bits, of which about one in `period` is set.
+template <class Container>
+Container Make(int64_t n, unsigned period, unsigned seed = 2026) {
+  auto engine = std::minstd_rand(seed);
+  auto bits = Container();
+  bits.reserve(n);
+  for (int64_t i = 0; i != n; ++i) {
+    bits.push_back(engine() % period == 0);
+  }
+  return bits;
+}
+
+template <class Container>
+void Count(benchmark::State &state) {
+  auto bits = Make<Container>(state.range(0), 2);
+  for (auto _ : state) {
+    std::size_t count;
+    if constexpr (std::is_same_v<Container, Bits>) {
+      count = bits.count();
+    } else {
+      count = std::count(bits.begin(), bits.end(), true);
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Count the bits of abc::dynamic_bitset by `__builtin_popcountll`, which is
+// what `count()` would cost without the kernels of "abc/simd.h".
+void CountScalar(benchmark::State &state) {
+  auto bits = Make<Bits>(state.range(0), 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        abc::simd::scalar::popcount(bits.data(), bits.num_blocks()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+template <class Container>
+void And(benchmark::State &state) {
+  auto a = Make<Container>(state.range(0), 2, 1);
+  auto b = Make<Container>(state.range(0), 2, 2);
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<Container, Bits>) {
+      a &= b;
+    } else {
+      for (std::size_t i = 0, n = a.size(); i != n; ++i) {
+        a[i] = a[i] && b[i];
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Set the middle half of the bits, then reset it.
+template <class Container>
+void SetRange(benchmark::State &state) {
+  auto bits = Make<Container>(state.range(0), 2);
+  auto pos = bits.size() / 4, count = bits.size() / 2;
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<Container, Bits>) {
+      bits.set(pos, count, true);
+      bits.reset(pos, count);
+    } else {
+      std::fill_n(bits.begin() + pos, count, true);
+      std::fill_n(bits.begin() + pos, count, false);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * (count + 1));
+}
+// Visit the set bits of a sparse mask, in which one in 64 bits is set.
+template <class Container>
+void IterateSetBits(benchmark::State &state) {
+  auto bits = Make<Container>(state.range(0), 64);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    if constexpr (std::is_same_v<Container, Bits>) {
+      for (auto i = bits.find_first(); i != Bits::npos;
+           i = bits.find_next(i)) {
+        sum += i;
+      }
+    } else {
+      for (std::size_t i = 0, n = bits.size(); i != n; ++i) {
+        if (bits[i]) {
+          sum += i;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define ABC_BENCH_BITS(Function) \
+  ABC_BENCH(Function, Bits); \
+  ABC_BENCH(Function, Bytes); \
+  ABC_BENCH(Function, StdBits)
+
+ABC_BENCH_BITS(Count);
+BENCHMARK(CountScalar)->Apply(abc::bench::Configure<Bits>);
+ABC_BENCH_BITS(And);
+ABC_BENCH_BITS(SetRange);
+ABC_BENCH_BITS(IterateSetBits);
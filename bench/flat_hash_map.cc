@@ -0,0 +1,111 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/flat_hash_map.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "abc/bench/utility.h"
+#include "benchmark/benchmark.h"
+
+// Keys spread over all bits, so that neither table benefits from `std::hash`
+// returning the integer itself:
+inline int Key(int i) { return static_cast<int>(uint32_t(i) * 2654435761u); }
+
+template <class Map>
+void Fill(Map *map, int n) {
+  for (int i = 0; i != n; ++i) {
+    map->try_emplace(Key(i), i);
+  }
+}
+
+template <class Map>
+void Insert(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto map = Map();
+    Fill(&map, n);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Map>
+void FindHit(benchmark::State &state) {
+  auto n = state.range(0);
+  auto map = Map();
+  Fill(&map, n);
+  for (auto _ : state) {
+    int sum = 0;
+    for (int i = 0; i != n; ++i) {
+      sum += map.find(Key(i))->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Map>
+void FindMiss(benchmark::State &state) {
+  auto n = state.range(0);
+  auto map = Map();
+  Fill(&map, n);
+  for (auto _ : state) {
+    int count = 0;
+    for (int i = 0; i != n; ++i) {
+      count += (map.find(Key(n + i)) == map.end());
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Map>
+void Erase(benchmark::State &state) {
+  auto n = state.range(0);
+  // Refill a batch of maps per pause to amortize the cost of pausing:
+  auto maps = std::vector<Map>(std::max<int64_t>(1, (1 << 16) / n));
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto &map : maps) {
+      Fill(&map, n);
+    }
+    state.ResumeTiming();
+    for (auto &map : maps) {
+      for (int i = 0; i != n; ++i) {
+        map.erase(Key(i));
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * maps.size() * n);
+}
+// Erase the oldest element and insert a new one, so the size stays at `n`
+// while the keys keep changing.
+template <class Map>
+void Churn(benchmark::State &state) {
+  auto n = state.range(0);
+  auto map = Map();
+  Fill(&map, n);
+  int oldest = 0;
+  for (auto _ : state) {
+    for (int i = 0; i != n; ++i, ++oldest) {
+      map.erase(Key(oldest));
+      map.try_emplace(Key(oldest + n), oldest);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+using StdMap = std::unordered_map<int, int>;
+using FlatMap = abc::flat_hash_map<int, int>;
+
+// Register `Function` for `std::unordered_map` and `abc::flat_hash_map`:
+#define ABC_BENCH_MAP(Function) \
+  ABC_BENCH(Function, StdMap); \
+  ABC_BENCH(Function, FlatMap)
+
+ABC_BENCH_MAP(Insert);
+ABC_BENCH_MAP(FindHit);
+ABC_BENCH_MAP(FindMiss);
+ABC_BENCH_MAP(Erase);
+ABC_BENCH_MAP(Churn);
@@ -0,0 +1,122 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/flat_map.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "abc/bench/utility.h"
+#include "benchmark/benchmark.h"
+
+// Keys are even, so that odd keys miss:
+inline int Key(int64_t i) { return static_cast<int>(2 * i); }
+
+// The same elements sorted in two `std::vector`s, searched by
+// `std::lower_bound`, as the baseline of abc::lower_bound.
+struct SortedVector {
+  std::vector<int> keys, values;
+
+  const int *find(int key) const {
+    auto iter = std::lower_bound(keys.begin(), keys.end(), key);
+    return iter != keys.end() && *iter == key
+        ? &values[iter - keys.begin()] : nullptr;
+  }
+};
+using StdMap = std::map<int, int>;
+using FlatMap = abc::flat_map<int, int>;
+
+inline const int *Find(const SortedVector &map, int key) {
+  return map.find(key);
+}
+template <class Map>
+const int *Find(const Map &map, int key) {
+  auto iter = map.find(key);
+  return iter != map.end() ? &iter->second : nullptr;
+}
+
+template <class Map>
+Map Build(int64_t n) {
+  auto keys = abc::vector<int>(n), values = abc::vector<int>(n);
+  for (int64_t i = 0; i != n; ++i) {
+    keys[i] = Key(i);
+    values[i] = static_cast<int>(i);
+  }
+  if constexpr (std::is_same_v<Map, FlatMap>) {
+    return Map(abc::sorted_unique, std::move(keys), std::move(values));
+  } else if constexpr (std::is_same_v<Map, SortedVector>) {
+    return Map{{keys.begin(), keys.end()}, {values.begin(), values.end()}};
+  } else {
+    auto map = Map();
+    for (int64_t i = 0; i != n; ++i) {
+      map.emplace_hint(map.end(), keys[i], values[i]);
+    }
+    return map;
+  }
+}
+
+// Look up random keys, which are present if `kHit`, so each search misses
+// the cache once the map outgrows it.
+template <class Map, bool kHit>
+void Lookup(benchmark::State &state) {
+  auto n = state.range(0);
+  auto map = Build<Map>(n);
+  auto engine = std::mt19937_64(n);
+  auto dist = std::uniform_int_distribution<int64_t>(0, n - 1);
+  auto probes = std::vector<int>(1 << 16);
+  for (auto &key : probes) {
+    key = Key(dist(engine)) + !kHit;
+  }
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto key : probes) {
+      auto value = Find(map, key);
+      sum += value ? *value : -1;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+template <class Map>
+void FindHit(benchmark::State &state) { Lookup<Map, true>(state); }
+template <class Map>
+void FindMiss(benchmark::State &state) { Lookup<Map, false>(state); }
+
+// Insert `n` random elements in batches of `n / 8`.
+template <class Map>
+void BulkInsert(benchmark::State &state) {
+  auto n = state.range(0);
+  auto engine = std::mt19937_64(n);
+  auto elements = std::vector<std::pair<int, int>>(n);
+  for (auto &[key, value] : elements) {
+    key = static_cast<int>(engine());
+    value = key;
+  }
+  auto batch = std::max<int64_t>(1, n / 8);
+  for (auto _ : state) {
+    auto map = Map();
+    for (int64_t i = 0; i < n; i += batch) {
+      auto first = elements.begin() + i;
+      map.insert(first, first + std::min(batch, n - i));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Sweep sizes from 10^3 to ABC_BENCH_MAX_SIZE (10^8 by default).
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(1000, ABC_BENCH_MAX_SIZE);
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+
+#define ABC_BENCH_LOOKUP(Function) \
+  BENCHMARK_TEMPLATE(Function, StdMap)->Apply(Configure); \
+  BENCHMARK_TEMPLATE(Function, SortedVector)->Apply(Configure); \
+  BENCHMARK_TEMPLATE(Function, FlatMap)->Apply(Configure)
+
+ABC_BENCH_LOOKUP(FindHit);
+ABC_BENCH_LOOKUP(FindMiss);
+BENCHMARK_TEMPLATE(BulkInsert, StdMap)->Apply(Configure);
+BENCHMARK_TEMPLATE(BulkInsert, FlatMap)->Apply(Configure);
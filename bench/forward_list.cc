@@ -0,0 +1,243 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/forward_list.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <utility>
+#include <vector>
+
+#include "abc/bench/utility.h"
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/memory_resource.h"
+#include "benchmark/benchmark.h"
+
+using Copyable = abc::data::Copyable;
+using MoveOnly = abc::data::MoveOnly;
+template <class T>
+using PooledList = abc::forward_list<T, abc::pool_allocator<T>>;
+
+template <class List>
+void Fill(List *list, int n) {
+  for (int i = 0; i != n; ++i) {
+    list->emplace_front(i);
+  }
+}
+
+template <class List>
+void EmplaceFront(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto list = List();
+    Fill(&list, n);
+    benchmark::DoNotOptimize(&list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void Churn(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  for (auto _ : state) {
+    for (int i = 0; i != n; ++i) {
+      list.pop_front();
+    }
+    Fill(&list, n);
+    benchmark::DoNotOptimize(&list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void CopyAssign(benchmark::State &state) {
+  auto n = state.range(0);
+  auto src = List(), dst = List();
+  Fill(&src, n);
+  for (auto _ : state) {
+    dst = src;
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void MoveAssign(benchmark::State &state) {
+  auto n = state.range(0);
+  auto a = List(), b = List();
+  Fill(&a, n);
+  for (auto _ : state) {
+    b = std::move(a);
+    a = std::move(b);
+    benchmark::ClobberMemory();
+  }
+}
+template <class List>
+void Iterate(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  for (auto _ : state) {
+    int sum = 0;
+    for (const auto &x : list) {
+      sum += abc::bench::Value(x);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void Equal(benchmark::State &state) {
+  auto n = state.range(0);
+  auto a = List(), b = List();
+  Fill(&a, n);
+  Fill(&b, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void Clear(benchmark::State &state) {
+  auto n = state.range(0);
+  // Refill a batch of containers per pause to amortize the cost of pausing:
+  auto lists = std::vector<List>(std::max<int64_t>(1, (1 << 16) / n));
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto &list : lists) {
+      Fill(&list, n);
+    }
+    state.ResumeTiming();
+    for (auto &list : lists) {
+      list.clear();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * lists.size() * n);
+}
+
+// The list operations only relink nodes.  Sorting by two orders in turn
+// makes every sort start from a scrambled order:
+inline uint32_t Scramble(int x) { return uint32_t(x) * 2654435761u; }
+template <class List>
+void Sort(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  auto by_value = [](const auto &x, const auto &y) {
+    return abc::bench::Value(x) < abc::bench::Value(y);
+  };
+  auto scrambled = [](const auto &x, const auto &y) {
+    return Scramble(abc::bench::Value(x)) < Scramble(abc::bench::Value(y));
+  };
+  auto odd = false;
+  for (auto _ : state) {
+    if ((odd = !odd)) {
+      list.sort(scrambled);
+    } else {
+      list.sort(by_value);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void Reverse(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  for (auto _ : state) {
+    list.reverse();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+// Run `operation(&lists[i], &others[i])` on batches of lists, which are
+// refilled by `refill(&lists[i], &others[i])` while the timer is paused.
+template <class List, class Refill, class Operation>
+void RunOnBatches(benchmark::State &state, Refill &&refill,
+                  Operation &&operation) {
+  auto n = state.range(0);
+  auto size = std::max<int64_t>(1, (1 << 16) / n);
+  auto lists = std::vector<List>(size), others = std::vector<List>(size);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int64_t i = 0; i != size; ++i) {
+      lists[i].clear();
+      others[i].clear();
+      refill(&lists[i], &others[i]);
+    }
+    state.ResumeTiming();
+    for (int64_t i = 0; i != size; ++i) {
+      operation(&lists[i], &others[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * size * n);
+}
+template <class List>
+void Merge(benchmark::State &state) {
+  auto n = state.range(0);
+  RunOnBatches<List>(state, [n](List *a, List *b) {
+    // Two sorted halves, interleaved by the merge:
+    for (int i = n; i > 0; i -= 2) {
+      a->emplace_front(i - 1);
+      b->emplace_front(i - 2);
+    }
+  }, [](List *a, List *b) { a->merge(*b); });
+}
+template <class List>
+void Unique(benchmark::State &state) {
+  auto n = state.range(0);
+  RunOnBatches<List>(state, [n](List *a, List *) {
+    for (int i = 0; i != n; ++i) {
+      a->emplace_front(i / 2);
+    }
+  }, [](List *a, List *) { a->unique(); });
+}
+template <class List>
+void RemoveIf(benchmark::State &state) {
+  auto n = state.range(0);
+  RunOnBatches<List>(state, [n](List *a, List *) { Fill(a, n); },
+      [](List *a, List *) {
+        a->remove_if([](const auto &x) { return abc::bench::Value(x) % 2; });
+      });
+}
+
+// Register `Function` for `std::forward_list<T>`, `abc::forward_list<T>`
+// and `abc::forward_list<T>` whose nodes are pooled:
+#define ABC_BENCH_LIST(Function, T) \
+  ABC_BENCH(Function, std::forward_list<T>); \
+  ABC_BENCH(Function, abc::forward_list<T>); \
+  ABC_BENCH(Function, PooledList<T>)
+
+ABC_BENCH_LIST(EmplaceFront, int);
+ABC_BENCH_LIST(EmplaceFront, Copyable);
+ABC_BENCH_LIST(EmplaceFront, MoveOnly);
+ABC_BENCH_LIST(Churn, int);
+ABC_BENCH_LIST(Churn, Copyable);
+ABC_BENCH_LIST(Churn, MoveOnly);
+// Copy assignment needs a copyable `T`:
+ABC_BENCH_LIST(CopyAssign, int);
+ABC_BENCH_LIST(CopyAssign, Copyable);
+ABC_BENCH_LIST(MoveAssign, int);
+ABC_BENCH_LIST(MoveAssign, Copyable);
+ABC_BENCH_LIST(MoveAssign, MoveOnly);
+ABC_BENCH_LIST(Iterate, int);
+ABC_BENCH_LIST(Iterate, Copyable);
+ABC_BENCH_LIST(Iterate, MoveOnly);
+ABC_BENCH_LIST(Equal, int);
+ABC_BENCH_LIST(Equal, Copyable);
+ABC_BENCH_LIST(Equal, MoveOnly);
+ABC_BENCH_LIST(Clear, int);
+ABC_BENCH_LIST(Clear, Copyable);
+ABC_BENCH_LIST(Clear, MoveOnly);
+ABC_BENCH_LIST(Sort, int);
+ABC_BENCH_LIST(Sort, Copyable);
+ABC_BENCH_LIST(Sort, MoveOnly);
+ABC_BENCH_LIST(Reverse, int);
+ABC_BENCH_LIST(Merge, int);
+ABC_BENCH_LIST(Merge, Copyable);
+ABC_BENCH_LIST(Unique, int);
+ABC_BENCH_LIST(Unique, Copyable);
+ABC_BENCH_LIST(RemoveIf, int);
+ABC_BENCH_LIST(RemoveIf, Copyable);
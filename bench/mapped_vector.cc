@@ -0,0 +1,99 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/mapped_vector.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include <unistd.h>
+
+#include "abc/bench/utility.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+// A row of a lookup table, which is computed from its index when rebuilt.
+struct Row {
+  int64_t key;
+  double weight;
+  int32_t left, right;
+  int64_t payload;
+
+  explicit Row(int64_t i)
+      : key(i * 7), weight(i * 0.5), left(static_cast<int32_t>(i - 1)),
+        right(static_cast<int32_t>(i + 1)), payload(i ^ 0x5bd1e995) {}
+};
+using Table = abc::vector<Row>;
+using MappedTable = abc::mapped_vector<Row>;
+
+// The file of a table of `n` rows, which is saved once per size, and removed
+// on exit.
+std::string TablePath(int64_t n) {
+  static struct Saved {
+    std::string path = (std::filesystem::temp_directory_path() /
+        ("abc_mapped_vector_bench_" + std::to_string(::getpid()))).string();
+    int64_t n = -1;
+    ~Saved() { std::remove(path.c_str()); }
+  } saved;
+  if (saved.n != n) {
+    std::remove(saved.path.c_str());
+    auto table = MappedTable(saved.path, abc::map_mode::kReadWrite);
+    table.reserve(n);
+    for (int64_t i = 0; i != n; ++i) {
+      table.emplace_back(i);
+    }
+    saved.n = n;
+  }
+  return saved.path;
+}
+
+int64_t Sum(const Row *first, const Row *last) {
+  int64_t sum = 0;
+  for (; first != last; ++first) {
+    sum += first->key + first->left;
+  }
+  return sum;
+}
+
+// Build the table again by `emplace_back()`, as on each start today.
+void Rebuild(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto table = Table();
+    for (int64_t i = 0; i != n; ++i) {
+      table.emplace_back(i);
+    }
+    benchmark::DoNotOptimize(Sum(table.begin(), table.end()));
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(Row));
+}
+// Map the saved table, and touch only its last row.
+void Open(benchmark::State &state) {
+  auto n = state.range(0);
+  auto path = TablePath(n);
+  for (auto _ : state) {
+    auto table = MappedTable(path, abc::map_mode::kReadOnly);
+    benchmark::DoNotOptimize(table.back().key);
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(Row));
+}
+// Map the saved table, and read every row, so all pages are faulted in.
+void OpenAndScan(benchmark::State &state) {
+  auto n = state.range(0);
+  auto path = TablePath(n);
+  for (auto _ : state) {
+    auto table = MappedTable(path, abc::map_mode::kReadOnly);
+    benchmark::DoNotOptimize(Sum(table.begin(), table.end()));
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(Row));
+}
+
+// Sweep from 4096 rows to `MaxSize<Row>() / 8`, i.e. 400 MB by default.
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(8)->Range(1 << 12, abc::bench::MaxSize<Row>() / 8);
+  b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(Rebuild)->Apply(Configure);
+BENCHMARK(Open)->Apply(Configure);
+BENCHMARK(OpenAndScan)->Apply(Configure);
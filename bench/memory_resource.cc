@@ -0,0 +1,75 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/memory_resource.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+using PmrVector = abc::vector<int, abc::polymorphic_allocator<int>>;
+
+// The number of small vectors alive at the same time, e.g. in a request.
+constexpr int kVectors = 1024;
+
+// Build `kVectors` vectors of `n` elements each, and then destroy them all.
+template <class Vector, class... Args>
+void Build(int n, Args... args) {
+  auto vectors = std::vector<Vector>();
+  vectors.reserve(kVectors);
+  for (int i = 0; i != kVectors; ++i) {
+    vectors.emplace_back(args...);
+    auto &v = vectors.back();
+    for (int j = 0; j != n; ++j) {
+      v.emplace_back(j);
+    }
+  }
+  benchmark::DoNotOptimize(vectors.data());
+}
+
+void StdAllocator(benchmark::State &state) {
+  for (auto _ : state) {
+    Build<abc::vector<int>>(state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * state.range(0));
+}
+void NewDeleteResource(benchmark::State &state) {
+  for (auto _ : state) {
+    Build<PmrVector>(state.range(0), abc::new_delete_resource());
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * state.range(0));
+}
+void MonotonicBufferResource(benchmark::State &state) {
+  for (auto _ : state) {
+    // Start from a stack buffer, and release everything at once:
+    alignas(std::max_align_t) char buffer[1 << 16];
+    auto resource = abc::monotonic_buffer_resource(buffer, sizeof(buffer));
+    Build<PmrVector>(state.range(0), &resource);
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * state.range(0));
+}
+void UnsynchronizedPoolResource(benchmark::State &state) {
+  auto resource = abc::unsynchronized_pool_resource();
+  for (auto _ : state) {
+    Build<PmrVector>(state.range(0), &resource);
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * state.range(0));
+}
+void SynchronizedPoolResource(benchmark::State &state) {
+  auto resource = abc::synchronized_pool_resource();
+  for (auto _ : state) {
+    Build<PmrVector>(state.range(0), &resource);
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * state.range(0));
+}
+
+// Each vector holds 8 to 1024 `int`s:
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(8, 1024);
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+BENCHMARK(StdAllocator)->Apply(Configure);
+BENCHMARK(NewDeleteResource)->Apply(Configure);
+BENCHMARK(MonotonicBufferResource)->Apply(Configure);
+BENCHMARK(UnsynchronizedPoolResource)->Apply(Configure);
+BENCHMARK(SynchronizedPoolResource)->Apply(Configure);
@@ -0,0 +1,68 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/mmap_allocator.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "abc/bench/utility.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+using MmapVector = abc::vector<int, abc::mmap_allocator<int>>;
+
+// Reset the peak resident set size of this process (Linux 4.0+).
+void ResetPeakRss() {
+  std::ofstream("/proc/self/clear_refs") << "5";
+}
+// Return the peak resident set size of this process in MiB, or 0 if unknown.
+double PeakRss() {
+  auto status = std::ifstream("/proc/self/status");
+  auto line = std::string();
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return std::stod(line.substr(6)) / 1024;  // in kB
+    }
+  }
+  return 0;
+}
+
+// Grow a vector to `n` elements by `emplace_back()`, so the whole buffer is
+// moved on each reallocation, unless it can be remapped in place.
+template <class Vector>
+void Grow(benchmark::State &state) {
+  auto n = state.range(0);
+  auto peak_rss = 0.0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ResetPeakRss();
+    state.ResumeTiming();
+    {
+      auto v = Vector();
+      for (int i = 0; i != n; ++i) {
+        v.emplace_back(i);
+      }
+      benchmark::DoNotOptimize(v.data());
+      state.PauseTiming();
+      peak_rss = std::max(peak_rss, PeakRss());
+    }
+    state.ResumeTiming();
+  }
+  state.counters["peak_rss_MiB"] = peak_rss;
+  state.SetBytesProcessed(state.iterations() * n * sizeof(int));
+}
+
+// Sweep from 4 MiB to 4 times the common maximum size, i.e. 1.6 GB by default:
+template <class Vector>
+void Configure(benchmark::internal::Benchmark *b) {
+  auto max_size = abc::bench::MaxSize<int>() * 4;
+  b->RangeMultiplier(8)->Range(std::min<int64_t>(1 << 20, max_size), max_size);
+  b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+#define ABC_BENCH_GROW(Container) \
+  BENCHMARK_TEMPLATE(Grow, Container)->Apply(Configure<Container>)
+
+ABC_BENCH_GROW(std::vector<int>);
+ABC_BENCH_GROW(abc::vector<int>);
+ABC_BENCH_GROW(MmapVector);
@@ -0,0 +1,36 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/mpmc_ring.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "abc/bench/queue.h"
+#include "benchmark/benchmark.h"
+
+using Stamp = int64_t;
+using LockedQueue = abc::bench::LockedQueue<Stamp>;
+using Ring = abc::mpmc_ring<Stamp>;
+
+// Threads of even indices push time stamps and those of odd indices pop
+// them, so every thread count is split into as many producers as consumers,
+// and all threads run the same number of iterations.
+template <class Queue>
+void PushPop(benchmark::State &state) {
+  static Queue queue(1024);
+  if (state.thread_index() % 2 == 0) {
+    for (auto _ : state) {
+      abc::bench::Push(&queue, abc::bench::Now());
+    }
+  } else {
+    auto latencies = std::vector<Stamp>();
+    latencies.reserve(1 << 20);
+    for (auto _ : state) {
+      latencies.push_back(abc::bench::Now() - abc::bench::Pop(&queue));
+    }
+    abc::bench::ReportLatency(state, &latencies, 2);
+    state.SetItemsProcessed(state.iterations());  // counted by consumers
+  }
+}
+
+BENCHMARK_TEMPLATE(PushPop, LockedQueue)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, Ring)->ThreadRange(2, 16)->UseRealTime();
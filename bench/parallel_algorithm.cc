@@ -0,0 +1,127 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/parallel_algorithm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <thread>  // NOLINT
+
+#include "abc/bench/utility.h"
+#include "abc/execution.h"
+#include "abc/thread_pool.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+// Every benchmark runs on vectors of this size, i.e. 10^8 by default.
+constexpr int64_t kSize = ABC_BENCH_MAX_SIZE;
+
+const abc::vector<double> &Input() {
+  static const auto input = [] {
+    auto v = abc::vector<double>(kSize);
+    auto random = std::mt19937(42);
+    auto uniform = std::uniform_real_distribution<double>(0.0, 1.0);
+    for (auto &x : v) {
+      x = uniform(random);
+    }
+    return v;
+  }();
+  return input;
+}
+
+// Run `algorithm(policy)` by `seq` on 1 thread, or by `par` on a pool of
+// `threads - 1` workers and the calling thread.
+template <class Algorithm>
+void RunOnThreads(benchmark::State &state, Algorithm &&algorithm) {
+  auto threads = state.range(0);
+  if (threads == 1) {
+    for (auto _ : state) {
+      algorithm(state, abc::execution::seq);
+    }
+  } else {
+    auto pool = abc::thread_pool(threads - 1);
+    for (auto _ : state) {
+      algorithm(state, abc::execution::par.on(pool));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+void ForEach(benchmark::State &state) {
+  auto v = Input();
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    abc::for_each(policy, v.begin(), v.end(),
+                  [](double &x) { x = std::sqrt(x); });
+    benchmark::ClobberMemory();
+  });
+}
+void Transform(benchmark::State &state) {
+  const auto &v = Input();
+  auto out = abc::vector<double>(kSize);
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    abc::transform(policy, v.begin(), v.end(), out.begin(),
+                   [](double x) { return std::exp(x); });
+    benchmark::ClobberMemory();
+  });
+}
+void Copy(benchmark::State &state) {
+  const auto &v = Input();
+  auto out = abc::vector<double>(kSize);
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    abc::copy(policy, v.begin(), v.end(), out.begin());
+    benchmark::ClobberMemory();
+  });
+}
+void Reduce(benchmark::State &state) {
+  const auto &v = Input();
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    benchmark::DoNotOptimize(abc::reduce(policy, v.begin(), v.end()));
+  });
+}
+void TransformReduce(benchmark::State &state) {
+  const auto &v = Input();
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    benchmark::DoNotOptimize(abc::transform_reduce(
+        policy, v.begin(), v.end(), 0.0, std::plus<>(),
+        [](double x) { return std::sin(x); }));
+  });
+}
+void InclusiveScan(benchmark::State &state) {
+  const auto &v = Input();
+  auto out = abc::vector<double>(kSize);
+  RunOnThreads(state, [&](benchmark::State &, auto &&policy) {
+    abc::inclusive_scan(policy, v.begin(), v.end(), out.begin());
+    benchmark::ClobberMemory();
+  });
+}
+void Sort(benchmark::State &state) {
+  const auto &v = Input();
+  auto out = abc::vector<double>(kSize);
+  RunOnThreads(state, [&](benchmark::State &state, auto &&policy) {
+    state.PauseTiming();
+    std::copy(v.begin(), v.end(), out.begin());
+    state.ResumeTiming();
+    abc::sort(policy, out.begin(), out.end());
+    benchmark::ClobberMemory();
+  });
+}
+
+// Sweep the number of threads from 1 (i.e. `seq`) to all cores.
+void Threads(benchmark::internal::Benchmark *b) {
+  auto cores = static_cast<int>(std::max(1u,
+                                         std::thread::hardware_concurrency()));
+  for (int threads = 1; threads < cores; threads *= 2) {
+    b->Arg(threads);
+  }
+  b->Arg(cores)->ArgName("threads");
+  b->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(ForEach)->Apply(Threads);
+BENCHMARK(Transform)->Apply(Threads);
+BENCHMARK(Copy)->Apply(Threads);
+BENCHMARK(Reduce)->Apply(Threads);
+BENCHMARK(TransformReduce)->Apply(Threads);
+BENCHMARK(InclusiveScan)->Apply(Threads);
+BENCHMARK(Sort)->Apply(Threads);
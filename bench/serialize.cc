@@ -0,0 +1,118 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/serialize.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "abc/bench/utility.h"
+#include "abc/forward_list.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+using Vector = abc::vector<int>;
+using List = abc::forward_list<int>;
+using Table = abc::vector<abc::vector<int>>;  // rows of 16 `int`s
+
+template <class Container>
+Container Make(int64_t n) {
+  auto container = Container();
+  if constexpr (std::is_same_v<Container, List>) {
+    auto tail = container.before_begin();
+    for (int64_t i = 0; i != n; ++i) {
+      tail = container.emplace_after(tail, static_cast<int>(i));
+    }
+  } else if constexpr (std::is_same_v<Container, Table>) {
+    for (int64_t i = 0; i != n; ++i) {
+      container.emplace_back(16, static_cast<int>(i));
+    }
+  } else {
+    for (int64_t i = 0; i != n; ++i) {
+      container.emplace_back(static_cast<int>(i));
+    }
+  }
+  return container;
+}
+
+// Write the container into a buffer, whose memory is reused.
+template <class Container>
+void WriteBuffer(benchmark::State &state) {
+  auto container = Make<Container>(state.range(0));
+  auto sink = abc::buffer_sink();
+  for (auto _ : state) {
+    sink.clear();
+    abc::serialize(sink, container);
+    benchmark::DoNotOptimize(sink.bytes().data());
+  }
+  state.SetBytesProcessed(state.iterations() * sink.bytes().size());
+}
+// Read the container from a buffer, into the same object.
+template <class Container>
+void ReadBuffer(benchmark::State &state) {
+  auto container = Make<Container>(state.range(0));
+  auto sink = abc::buffer_sink();
+  abc::serialize(sink, container);
+  for (auto _ : state) {
+    auto source = abc::buffer_source(sink.bytes());
+    abc::deserialize(source, container);
+    benchmark::DoNotOptimize(&container);
+  }
+  state.SetBytesProcessed(state.iterations() * sink.bytes().size());
+}
+// Write the container into a file, and read it back.
+template <class Container>
+void WriteAndReadFile(benchmark::State &state) {
+  auto container = Make<Container>(state.range(0));
+  auto path = (std::filesystem::temp_directory_path() /
+      ("abc_serialize_bench_" + std::to_string(::getpid()))).string();
+  auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  int64_t bytes = 0;
+  for (auto _ : state) {
+    ::ftruncate(fd, 0);
+    ::lseek(fd, 0, SEEK_SET);
+    {
+      auto sink = abc::fd_sink(fd);
+      abc::serialize(sink, container);
+    }
+    bytes = ::lseek(fd, 0, SEEK_CUR);
+    ::lseek(fd, 0, SEEK_SET);
+    auto source = abc::fd_source(fd);
+    abc::deserialize(source, container);
+  }
+  ::close(fd);
+  std::remove(path.c_str());
+  state.SetBytesProcessed(state.iterations() * 2 * bytes);
+}
+// Write each element through an iostream, as before abc/serialize.h.
+template <class Container>
+void WriteStream(benchmark::State &state) {
+  auto container = Make<Container>(state.range(0));
+  auto stream = std::stringstream();
+  for (auto _ : state) {
+    stream.str(std::string());
+    auto n = static_cast<std::uint64_t>(
+        std::distance(container.begin(), container.end()));
+    stream.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    for (auto &x : container) {
+      stream.write(reinterpret_cast<const char *>(&x), sizeof(x));
+    }
+    benchmark::DoNotOptimize(stream.tellp());
+  }
+  state.SetBytesProcessed(state.iterations() * stream.tellp());
+}
+
+#define ABC_BENCH_SERIALIZE(Function) \
+  ABC_BENCH(Function, Vector); \
+  ABC_BENCH(Function, List); \
+  ABC_BENCH(Function, Table)
+
+ABC_BENCH_SERIALIZE(WriteBuffer);
+ABC_BENCH_SERIALIZE(ReadBuffer);
+ABC_BENCH_SERIALIZE(WriteAndReadFile);
+ABC_BENCH(WriteStream, Vector);
+ABC_BENCH(WriteStream, List);
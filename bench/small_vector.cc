@@ -0,0 +1,70 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/small_vector.h"
+
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+using Copyable = abc::data::Copyable;
+
+// The number of small vectors alive at the same time, e.g. in a request.
+constexpr int kVectors = 1024;
+
+// Build `kVectors` vectors of `n` elements each, and then destroy them all.
+template <class Vector>
+void Build(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto vectors = std::vector<Vector>(kVectors);
+    for (auto &v : vectors) {
+      for (int j = 0; j != n; ++j) {
+        v.emplace_back(j);
+      }
+    }
+    benchmark::DoNotOptimize(vectors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * n);
+}
+// Move `kVectors` vectors of `n` elements each.
+template <class Vector>
+void Move(benchmark::State &state) {
+  auto n = state.range(0);
+  auto vectors = std::vector<Vector>(kVectors);
+  for (auto &v : vectors) {
+    for (int j = 0; j != n; ++j) {
+      v.emplace_back(j);
+    }
+  }
+  for (auto _ : state) {
+    for (auto &v : vectors) {
+      auto moved = abc::move(v);
+      benchmark::DoNotOptimize(moved.data());
+      v = abc::move(moved);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors);
+}
+
+// Each vector holds 1 to 64 elements, around the inline capacity of 16:
+template <class Vector>
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(1, 64);
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+#define ABC_BENCH_SMALL(Function, Container) \
+  BENCHMARK_TEMPLATE(Function, Container)->Apply(Configure<Container>)
+
+using SmallVector = abc::small_vector<int, 16>;
+using SmallVectorOfCopyable = abc::small_vector<Copyable, 16>;
+ABC_BENCH_SMALL(Build, std::vector<int>);
+ABC_BENCH_SMALL(Build, abc::vector<int>);
+ABC_BENCH_SMALL(Build, SmallVector);
+ABC_BENCH_SMALL(Build, std::vector<Copyable>);
+ABC_BENCH_SMALL(Build, abc::vector<Copyable>);
+ABC_BENCH_SMALL(Build, SmallVectorOfCopyable);
+ABC_BENCH_SMALL(Move, std::vector<int>);
+ABC_BENCH_SMALL(Move, abc::vector<int>);
+ABC_BENCH_SMALL(Move, SmallVector);
@@ -0,0 +1,140 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/soa_vector.h"
+
+#include <cstdint>
+
+#include "abc/bench/utility.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+// A record of 8 fields (56 bytes), of which each loop touches one or two.
+struct Particle {
+  double x, y, z;
+  double vx, vy, vz;
+  float mass;
+  int32_t id;
+};
+using Aos = abc::vector<Particle>;
+using Soa = abc::soa_vector<double, double, double, double, double, double,
+                            float, int32_t>;
+enum Field { kX, kY, kZ, kVx, kVy, kVz, kMass, kId };
+
+template <class Container>
+Container Make(int64_t n) {
+  auto particles = Container();
+  particles.reserve(n);
+  for (int64_t i = 0; i != n; ++i) {
+    auto d = static_cast<double>(i);
+    auto mass = static_cast<float>(i % 100);
+    auto id = static_cast<int32_t>(i);
+    if constexpr (std::is_same_v<Container, Aos>) {
+      particles.push_back({d, d, d, 1.0, 2.0, 3.0, mass, id});
+    } else {
+      particles.emplace_back(d, d, d, 1.0, 2.0, 3.0, mass, id);
+    }
+  }
+  return particles;
+}
+
+// Read one field of each record.
+template <class Container>
+void SumX(benchmark::State &state) {
+  auto particles = Make<Container>(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    if constexpr (std::is_same_v<Container, Aos>) {
+      for (auto &p : particles) {
+        sum += p.x;
+      }
+    } else {
+      for (auto x : particles.template column<kX>()) {
+        sum += x;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Read one field and write another of each record.
+template <class Container>
+void Move(benchmark::State &state) {
+  auto particles = Make<Container>(state.range(0));
+  constexpr double kDt = 0.01;
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<Container, Aos>) {
+      for (auto &p : particles) {
+        p.x += p.vx * kDt;
+      }
+    } else {
+      auto x = particles.template data<kX>();
+      auto vx = particles.template data<kVx>();
+      for (std::size_t i = 0, n = particles.size(); i != n; ++i) {
+        x[i] += vx[i] * kDt;
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Count the records of a field over a threshold.
+template <class Container>
+void CountHeavy(benchmark::State &state) {
+  auto particles = Make<Container>(state.range(0));
+  for (auto _ : state) {
+    int64_t count = 0;
+    if constexpr (std::is_same_v<Container, Aos>) {
+      for (auto &p : particles) {
+        count += p.mass > 50.0f;
+      }
+    } else {
+      for (auto mass : particles.template column<kMass>()) {
+        count += mass > 50.0f;
+      }
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Read all fields of each record, where structure of arrays does not help.
+template <class Container>
+void SumAll(benchmark::State &state) {
+  auto particles = Make<Container>(state.range(0));
+  for (auto _ : state) {
+    double sum = 0;
+    if constexpr (std::is_same_v<Container, Aos>) {
+      for (auto &p : particles) {
+        sum += p.x + p.y + p.z + p.vx + p.vy + p.vz + p.mass + p.id;
+      }
+    } else {
+      for (auto [x, y, z, vx, vy, vz, mass, id] : particles) {
+        sum += x + y + z + vx + vy + vz + mass + id;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+template <class Container>
+void EmplaceBack(benchmark::State &state) {
+  for (auto _ : state) {
+    auto particles = Make<Container>(state.range(0));
+    benchmark::DoNotOptimize(particles.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Sweep from 8 to `MaxSize<Particle>() / 10` records, i.e. 560 MB by default.
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(8)->Range(8, abc::bench::MaxSize<Particle>() / 10);
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+
+#define ABC_BENCH_LAYOUT(Function) \
+  BENCHMARK_TEMPLATE(Function, Aos)->Apply(Configure); \
+  BENCHMARK_TEMPLATE(Function, Soa)->Apply(Configure)
+
+ABC_BENCH_LAYOUT(SumX);
+ABC_BENCH_LAYOUT(Move);
+ABC_BENCH_LAYOUT(CountHeavy);
+ABC_BENCH_LAYOUT(SumAll);
+ABC_BENCH_LAYOUT(EmplaceBack);
@@ -0,0 +1,69 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/spsc_ring.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/bench/queue.h"
+#include "abc/mpmc_ring.h"
+#include "benchmark/benchmark.h"
+
+using Stamp = int64_t;
+using LockedQueue = abc::bench::LockedQueue<Stamp>;
+using SpscRing = abc::spsc_ring<Stamp>;
+using MpmcRing = abc::mpmc_ring<Stamp>;
+
+// Thread 0 pushes time stamps and thread 1 pops them.
+template <class Queue>
+void PushPop(benchmark::State &state) {
+  static Queue queue(1024);
+  if (state.thread_index() == 0) {
+    for (auto _ : state) {
+      abc::bench::Push(&queue, abc::bench::Now());
+    }
+  } else {
+    auto latencies = std::vector<Stamp>();
+    latencies.reserve(1 << 20);
+    for (auto _ : state) {
+      latencies.push_back(abc::bench::Now() - abc::bench::Pop(&queue));
+    }
+    abc::bench::ReportLatency(state, &latencies, 2);
+    state.SetItemsProcessed(state.iterations());  // counted by consumers
+  }
+}
+// The same, but each iteration pushes or pops a batch of `kBatch` stamps.
+void PushPopBatch(benchmark::State &state) {
+  constexpr int kBatch = 16;
+  static SpscRing ring(1024);
+  Stamp batch[kBatch];
+  if (state.thread_index() == 0) {
+    for (auto _ : state) {
+      std::fill(batch, batch + kBatch, abc::bench::Now());
+      auto *first = ring.try_push(batch, batch + kBatch);
+      while (first != batch + kBatch) {
+        std::this_thread::yield();
+        first = ring.try_push(first, batch + kBatch);
+      }
+    }
+  } else {
+    auto latencies = std::vector<Stamp>();
+    latencies.reserve(1 << 20);
+    for (auto _ : state) {
+      auto n = ring.try_pop(batch, kBatch);
+      while (n != kBatch) {
+        std::this_thread::yield();
+        n += ring.try_pop(batch + n, kBatch - n);
+      }
+      latencies.push_back(abc::bench::Now() - batch[0]);
+    }
+    abc::bench::ReportLatency(state, &latencies, 2);
+    state.SetItemsProcessed(state.iterations() * kBatch);
+  }
+}
+
+BENCHMARK_TEMPLATE(PushPop, LockedQueue)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, MpmcRing)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, SpscRing)->Threads(2)->UseRealTime();
+BENCHMARK(PushPopBatch)->Threads(2)->UseRealTime();
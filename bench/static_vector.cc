@@ -0,0 +1,87 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/static_vector.h"
+
+#include <vector>
+
+#include "abc/small_vector.h"
+#include "abc/vector.h"
+#include "benchmark/benchmark.h"
+
+// The number of buffers alive at the same time, e.g. one per packet.
+constexpr int kVectors = 1024;
+
+template <class Vector>
+std::vector<Vector> Make(int64_t n) {
+  auto vectors = std::vector<Vector>(kVectors);
+  for (auto &v : vectors) {
+    for (int j = 0; j != n; ++j) {
+      v.emplace_back(j);
+    }
+  }
+  return vectors;
+}
+
+// Build `kVectors` vectors of `n` elements each, and then destroy them all.
+template <class Vector>
+void Build(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto vectors = Make<Vector>(n);
+    benchmark::DoNotOptimize(vectors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * n);
+}
+// Copy `kVectors` vectors of `n` elements each into existing ones.
+template <class Vector>
+void Copy(benchmark::State &state) {
+  auto n = state.range(0);
+  auto vectors = Make<Vector>(n);
+  auto copies = std::vector<Vector>(kVectors);
+  for (auto _ : state) {
+    for (int i = 0; i != kVectors; ++i) {
+      copies[i] = vectors[i];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors);
+}
+// Sum the elements of `kVectors` vectors, which are next to their owners.
+template <class Vector>
+void Sum(benchmark::State &state) {
+  auto n = state.range(0);
+  auto vectors = Make<Vector>(n);
+  for (auto _ : state) {
+    int sum = 0;
+    for (auto &v : vectors) {
+      for (auto x : v) {
+        sum += x;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors * n);
+}
+
+// Each vector holds 1 to 64 elements, up to the capacity of 64:
+template <class Vector>
+void Configure(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(1, 64);
+  b->MinWarmUpTime(0.1)->Unit(benchmark::kMicrosecond);
+}
+#define ABC_BENCH_STATIC(Function, Container) \
+  BENCHMARK_TEMPLATE(Function, Container)->Apply(Configure<Container>)
+
+using SmallVector = abc::small_vector<int, 64>;
+using StaticVector = abc::static_vector<int, 64>;
+ABC_BENCH_STATIC(Build, std::vector<int>);
+ABC_BENCH_STATIC(Build, abc::vector<int>);
+ABC_BENCH_STATIC(Build, SmallVector);
+ABC_BENCH_STATIC(Build, StaticVector);
+ABC_BENCH_STATIC(Copy, std::vector<int>);
+ABC_BENCH_STATIC(Copy, abc::vector<int>);
+ABC_BENCH_STATIC(Copy, SmallVector);
+ABC_BENCH_STATIC(Copy, StaticVector);
+ABC_BENCH_STATIC(Sum, std::vector<int>);
+ABC_BENCH_STATIC(Sum, abc::vector<int>);
+ABC_BENCH_STATIC(Sum, SmallVector);
+ABC_BENCH_STATIC(Sum, StaticVector);
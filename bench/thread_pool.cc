@@ -0,0 +1,93 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <future>  // NOLINT
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Submit this many empty tasks from outside, then wait for all of them.
+constexpr int64_t kTinyTasks = 1 << 14;
+
+void SubmitTiny(benchmark::State &state) {
+  auto pool = abc::thread_pool(state.range(0));
+  auto futures = std::vector<std::future<void>>();
+  futures.reserve(kTinyTasks);
+  for (auto _ : state) {
+    for (int64_t i = 0; i != kTinyTasks; ++i) {
+      futures.push_back(pool.submit([] {}));
+    }
+    for (auto &future : futures) {
+      future.wait();
+    }
+    futures.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kTinyTasks);
+}
+
+// Spawn the tiny tasks from a worker, which pushes them to its own deque, so
+// the others only get them by stealing.
+void ParallelForTiny(benchmark::State &state) {
+  auto pool = abc::thread_pool(state.range(0));
+  auto sum = std::atomic<int64_t>(0);
+  for (auto _ : state) {
+    pool.submit([&] {
+      pool.parallel_for(0, kTinyTasks, [&](std::size_t i) {
+        sum.fetch_add(i, std::memory_order_relaxed);
+      }, 1);
+    }).wait();
+  }
+  benchmark::DoNotOptimize(sum.load());
+  state.SetItemsProcessed(state.iterations() * kTinyTasks);
+}
+
+// Fork both calls down to the leaves, so every call is a task.
+int64_t Fib(abc::thread_pool *pool, int n) {
+  if (n < 2) {
+    return n;
+  }
+  int64_t a, b;
+  pool->invoke([&] { a = Fib(pool, n - 1); }, [&] { b = Fib(pool, n - 2); });
+  return a + b;
+}
+int64_t SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+constexpr int kFib = 25;
+constexpr int64_t kFibCalls = 242785;  // the number of calls of `Fib(25)`
+
+// The time per call over `SerialFib()` is the overhead of forking and joining.
+void SerialFibCalls(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SerialFib(kFib));
+  }
+  state.SetItemsProcessed(state.iterations() * kFibCalls);
+}
+void ParallelFib(benchmark::State &state) {
+  auto pool = abc::thread_pool(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        pool.submit([&] { return Fib(&pool, kFib); }).get());
+  }
+  state.SetItemsProcessed(state.iterations() * kFibCalls);
+}
+
+// Sweep the number of workers from 1 to all cores.
+void Workers(benchmark::internal::Benchmark *b) {
+  auto cores = static_cast<int>(std::max(1u,
+                                         std::thread::hardware_concurrency()));
+  for (int workers = 1; workers < cores; workers *= 2) {
+    b->Arg(workers);
+  }
+  b->Arg(cores)->ArgName("workers");
+  b->UseRealTime()->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(SubmitTiny)->Apply(Workers);
+BENCHMARK(ParallelForTiny)->Apply(Workers);
+BENCHMARK(SerialFibCalls)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(ParallelFib)->Apply(Workers);
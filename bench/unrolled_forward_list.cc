@@ -0,0 +1,85 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/unrolled_forward_list.h"
+
+#include <forward_list>
+#include <iterator>
+
+#include "abc/bench/utility.h"
+#include "abc/forward_list.h"
+#include "benchmark/benchmark.h"
+
+// Append `n` elements, which fills every node of an unrolled list.
+template <class List>
+void Fill(List *list, int n) {
+  auto iter = list->before_begin();
+  for (int i = 0; i != n; ++i) {
+    iter = list->emplace_after(iter, i);
+  }
+}
+
+template <class List>
+void Append(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto list = List();
+    Fill(&list, n);
+    benchmark::DoNotOptimize(&list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void EmplaceFront(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto list = List();
+    for (int i = 0; i != n; ++i) {
+      list.emplace_front(i);
+    }
+    benchmark::DoNotOptimize(&list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class List>
+void Iterate(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  for (auto _ : state) {
+    int sum = 0;
+    for (const auto &x : list) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+// Erase every other element, then put them back.
+template <class List>
+void EraseInsert(benchmark::State &state) {
+  auto n = state.range(0);
+  auto list = List();
+  Fill(&list, n);
+  for (auto _ : state) {
+    for (auto iter = list.begin();
+         iter != list.end() && std::next(iter) != list.end();) {
+      iter = list.erase_after(iter);
+    }
+    for (auto iter = list.begin(); iter != list.end(); ++iter) {
+      iter = list.emplace_after(iter, 0);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Register `Function` for singly linked lists of `int`, with one or more
+// elements per node:
+#define ABC_BENCH_LIST(Function) \
+  ABC_BENCH(Function, std::forward_list<int>); \
+  ABC_BENCH(Function, abc::forward_list<int>); \
+  ABC_BENCH(Function, abc::unrolled_forward_list<int>)
+
+ABC_BENCH_LIST(Append);
+ABC_BENCH_LIST(EmplaceFront);
+ABC_BENCH_LIST(Iterate);
+ABC_BENCH_LIST(EraseInsert);
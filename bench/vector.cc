@@ -0,0 +1,255 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <utility>
+#include <vector>
+
+#include "abc/algorithm.h"
+#include "abc/bench/utility.h"
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "benchmark/benchmark.h"
+
+using Copyable = abc::data::Copyable;
+using MoveOnly = abc::data::MoveOnly;
+// Grow by 3/2, so that freed blocks may be reused by later growth:
+template <class T>
+using SlowGrowingVector =
+    abc::vector<T, std::allocator<T>, abc::growth_policy<3, 2>>;
+
+template <class Vector>
+void Fill(Vector *v, int n) {
+  for (int i = 0; i != n; ++i) {
+    v->emplace_back(i);
+  }
+}
+
+template <class Vector>
+void EmplaceBack(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto v = Vector();
+    Fill(&v, n);
+    benchmark::DoNotOptimize(&v.back());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void EmplaceBackReserved(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto v = Vector();
+    v.reserve(n);
+    Fill(&v, n);
+    benchmark::DoNotOptimize(&v.back());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+// Pop and push around a quarter of the capacity, where eager shrinking
+// would reallocate on every cycle.
+template <class Vector>
+void PushPop(benchmark::State &state) {
+  auto n = state.range(0);
+  auto v = Vector();
+  Fill(&v, n);
+  while (v.size() > std::size_t(n / 4 + 1)) {
+    v.pop_back();
+  }
+  for (auto _ : state) {
+    for (int i = 0; i != 64; ++i) {
+      v.pop_back();
+      v.emplace_back(i);
+    }
+    benchmark::DoNotOptimize(&v.back());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+template <class Vector>
+void Resize(benchmark::State &state) {
+  auto n = state.range(0);
+  for (auto _ : state) {
+    auto v = Vector();
+    v.resize(n);
+    benchmark::DoNotOptimize(&v.back());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void CopyAssign(benchmark::State &state) {
+  auto n = state.range(0);
+  auto src = Vector(), dst = Vector();
+  Fill(&src, n);
+  for (auto _ : state) {
+    dst = src;
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void MoveAssign(benchmark::State &state) {
+  auto n = state.range(0);
+  auto a = Vector(), b = Vector();
+  Fill(&a, n);
+  for (auto _ : state) {
+    b = std::move(a);
+    a = std::move(b);
+    benchmark::ClobberMemory();
+  }
+}
+template <class Vector>
+void Iterate(benchmark::State &state) {
+  auto n = state.range(0);
+  auto v = Vector();
+  Fill(&v, n);
+  for (auto _ : state) {
+    int sum = 0;
+    for (const auto &x : v) {
+      sum += abc::bench::Value(x);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void Equal(benchmark::State &state) {
+  auto n = state.range(0);
+  auto a = Vector(), b = Vector();
+  Fill(&a, n);
+  Fill(&b, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+// Insert a forward range in front of the last few elements, which grows and
+// shifts the vector once instead of once per element.
+template <class Vector>
+void InsertRange(benchmark::State &state) {
+  auto n = state.range(0);
+  using T = typename Vector::value_type;
+  auto list = std::forward_list<T>();
+  for (int i = 0; i != n; ++i) {
+    list.emplace_front(i);
+  }
+  for (auto _ : state) {
+    auto v = Vector();
+    Fill(&v, 8);
+    v.insert(v.end() - 4, list.begin(), list.end());
+    benchmark::DoNotOptimize(&v.back());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void Less(benchmark::State &state) {
+  auto n = state.range(0);
+  auto a = Vector(), b = Vector();
+  Fill(&a, n);
+  Fill(&b, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a < b);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+// Search each vector by the algorithms of its own namespace:
+template <class T>
+auto Find(const std::vector<T> &v, const T &x) {
+  return std::find(v.begin(), v.end(), x);
+}
+template <class T>
+auto Find(const abc::vector<T> &v, const T &x) {
+  return abc::find(v.begin(), v.end(), x);
+}
+template <class T>
+auto Count(const std::vector<T> &v, const T &x) {
+  return std::count(v.begin(), v.end(), x);
+}
+template <class T>
+auto Count(const abc::vector<T> &v, const T &x) {
+  return abc::count(v.begin(), v.end(), x);
+}
+template <class Vector>
+void FindLast(benchmark::State &state) {
+  auto n = state.range(0);
+  auto v = Vector();
+  Fill(&v, n);
+  auto x = v.back();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Find(v, x));
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void CountAll(benchmark::State &state) {
+  auto n = state.range(0);
+  auto v = Vector();
+  Fill(&v, n);
+  auto x = v.back();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Count(v, x));
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+template <class Vector>
+void Clear(benchmark::State &state) {
+  auto n = state.range(0);
+  // Refill a batch of containers per pause to amortize the cost of pausing:
+  auto vectors = std::vector<Vector>(std::max<int64_t>(1, (1 << 16) / n));
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto &v : vectors) {
+      Fill(&v, n);
+    }
+    state.ResumeTiming();
+    for (auto &v : vectors) {
+      v.clear();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * vectors.size() * n);
+}
+
+// Register `Function` for both `std::vector<T>` and `abc::vector<T>`:
+#define ABC_BENCH_VECTOR(Function, T) \
+  ABC_BENCH(Function, std::vector<T>); \
+  ABC_BENCH(Function, abc::vector<T>)
+
+ABC_BENCH_VECTOR(EmplaceBack, int);
+ABC_BENCH_VECTOR(EmplaceBack, Copyable);
+ABC_BENCH_VECTOR(EmplaceBack, MoveOnly);
+ABC_BENCH(EmplaceBack, SlowGrowingVector<int>);
+ABC_BENCH(EmplaceBack, SlowGrowingVector<Copyable>);
+ABC_BENCH_VECTOR(EmplaceBackReserved, int);
+ABC_BENCH_VECTOR(EmplaceBackReserved, Copyable);
+ABC_BENCH_VECTOR(PushPop, int);
+ABC_BENCH_VECTOR(PushPop, Copyable);
+// `resize()` and copy assignment need a copyable `T`:
+ABC_BENCH_VECTOR(Resize, int);
+ABC_BENCH_VECTOR(Resize, Copyable);
+ABC_BENCH_VECTOR(CopyAssign, int);
+ABC_BENCH_VECTOR(CopyAssign, Copyable);
+ABC_BENCH_VECTOR(MoveAssign, int);
+ABC_BENCH_VECTOR(MoveAssign, Copyable);
+ABC_BENCH_VECTOR(MoveAssign, MoveOnly);
+ABC_BENCH_VECTOR(Iterate, int);
+ABC_BENCH_VECTOR(Iterate, Copyable);
+ABC_BENCH_VECTOR(Iterate, MoveOnly);
+ABC_BENCH_VECTOR(Equal, int);
+ABC_BENCH_VECTOR(Equal, Copyable);
+ABC_BENCH_VECTOR(Equal, MoveOnly);
+ABC_BENCH_VECTOR(Equal, double);
+ABC_BENCH_VECTOR(Less, int);
+ABC_BENCH_VECTOR(Less, double);
+ABC_BENCH_VECTOR(FindLast, int);
+ABC_BENCH_VECTOR(FindLast, int64_t);
+ABC_BENCH_VECTOR(FindLast, double);
+ABC_BENCH_VECTOR(CountAll, int);
+ABC_BENCH_VECTOR(CountAll, int64_t);
+ABC_BENCH_VECTOR(CountAll, double);
+ABC_BENCH_VECTOR(InsertRange, int);
+ABC_BENCH_VECTOR(InsertRange, Copyable);
+ABC_BENCH_VECTOR(Clear, int);
+ABC_BENCH_VECTOR(Clear, Copyable);
+ABC_BENCH_VECTOR(Clear, MoveOnly);
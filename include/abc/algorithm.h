@@ -0,0 +1,211 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_ALGORITHM_H_
+#define ABC_ALGORITHM_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "abc/simd.h"
+
+// Drop-in replacements of some `std` algorithms, which run the kernels in
+// "abc/simd.h" on contiguous arrays (e.g. abc::vector<int>) of integers or
+// floating-point numbers, and fall back to `std` otherwise.  The overloads
+// taking an execution policy are in "abc/parallel_algorithm.h".
+namespace abc {
+namespace internal {
+
+// The element type of `It`, if `It` points into such an array, or `void`.
+template <class It, class = void>
+struct vectorizable_element { using type = void; };
+template <class T>
+struct vectorizable_element<T *, std::enable_if_t<
+    simd::is_vectorizable_v<std::remove_cv_t<T>>>> {
+  using type = std::remove_cv_t<T>;
+};
+template <class It>
+using vectorizable_element_t = typename vectorizable_element<It>::type;
+
+// Whether `[first, last)` of `It` can be passed to the kernels.
+template <class It>
+inline constexpr bool is_vectorizable_v =
+    !std::is_void_v<vectorizable_element_t<It>>;
+// Whether `a == b` for two iterators of `It1` and `It2` compares two `T`s.
+template <class It1, class It2>
+inline constexpr bool is_vectorizable_pair_v = is_vectorizable_v<It1> &&
+    std::is_same_v<vectorizable_element_t<It1>, vectorizable_element_t<It2>>;
+// Whether searching `It` for a `U` can be vectorized, i.e. `x == value`
+// compares two elements, e.g. an `int` is converted to a `long`, but a
+// `long` is not converted to an `int`.
+template <class It, class U>
+constexpr bool is_vectorizable_search() {
+  if constexpr (is_vectorizable_v<It> && std::is_arithmetic_v<U>) {
+    using T = vectorizable_element_t<It>;
+    return std::is_same_v<std::common_type_t<T, U>, T>;
+  } else {
+    return false;
+  }
+}
+// Whether two `T`s are equal if and only if their bytes are equal.
+template <class T>
+inline constexpr bool is_bitwise_comparable_v =
+    std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+}  // namespace internal
+
+template <class InputIt, class T>
+InputIt find(InputIt first, InputIt last, const T &value) {
+  using V = internal::vectorizable_element_t<InputIt>;
+  if constexpr (internal::is_vectorizable_search<InputIt, T>()) {
+    return first + (simd::find<V>(first, last, value) - first);
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+template <class InputIt, class T>
+typename std::iterator_traits<InputIt>::difference_type
+count(InputIt first, InputIt last, const T &value) {
+  using V = internal::vectorizable_element_t<InputIt>;
+  if constexpr (internal::is_vectorizable_search<InputIt, T>()) {
+    return simd::count<V>(first, last, value);
+  } else {
+    return std::count(first, last, value);
+  }
+}
+
+template <class InputIt1, class InputIt2>
+std::pair<InputIt1, InputIt2>
+mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  if constexpr (internal::is_vectorizable_pair_v<InputIt1, InputIt2>) {
+    using V = internal::vectorizable_element_t<InputIt1>;
+    auto i = simd::mismatch<V>(first1, first2, last1 - first1);
+    return {first1 + i, first2 + i};
+  } else {
+    return std::mismatch(first1, last1, first2);
+  }
+}
+template <class InputIt1, class InputIt2>
+std::pair<InputIt1, InputIt2>
+mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+  if constexpr (internal::is_vectorizable_pair_v<InputIt1, InputIt2>) {
+    auto n = std::min(last1 - first1, last2 - first2);
+    return abc::mismatch(first1, first1 + n, first2);
+  } else {
+    return std::mismatch(first1, last1, first2, last2);
+  }
+}
+
+// Return false at once if the ranges are random access and differ in size.
+template <class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+  using Category1 = typename std::iterator_traits<InputIt1>::iterator_category;
+  using Category2 = typename std::iterator_traits<InputIt2>::iterator_category;
+  constexpr bool kRandomAccess =
+      std::is_base_of_v<std::random_access_iterator_tag, Category1> &&
+      std::is_base_of_v<std::random_access_iterator_tag, Category2>;
+  if constexpr (internal::is_vectorizable_pair_v<InputIt1, InputIt2>) {
+    auto n = last1 - first1;
+    if (n != last2 - first2) {
+      return false;
+    }
+    using V = internal::vectorizable_element_t<InputIt1>;
+    if constexpr (internal::is_bitwise_comparable_v<V>) {
+      return n == 0 || std::memcmp(first1, first2, n * sizeof(V)) == 0;
+    } else {  // e.g. `0.0 == -0.0` but `NaN != NaN`
+      return simd::mismatch<V>(first1, first2, n) == std::size_t(n);
+    }
+  } else if constexpr (kRandomAccess) {
+    return last1 - first1 == last2 - first2 &&
+           std::equal(first1, last1, first2);
+  } else {
+    return std::equal(first1, last1, first2, last2);
+  }
+}
+
+template <class InputIt1, class InputIt2>
+bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                             InputIt2 first2, InputIt2 last2) {
+  if constexpr (internal::is_vectorizable_pair_v<InputIt1, InputIt2>) {
+    using V = internal::vectorizable_element_t<InputIt1>;
+    auto n1 = last1 - first1, n2 = last2 - first2;
+    std::size_t n = std::min(n1, n2);
+    // Skip the common prefix, then decide by the first unequal pair, unless
+    // neither is less than the other (i.e. one of them is NaN):
+    for (std::size_t i = 0; ; ++i) {
+      i += simd::mismatch<V>(first1 + i, first2 + i, n - i);
+      if (i == n) {
+        return n1 < n2;
+      } else if (first1[i] < first2[i]) {
+        return true;
+      } else if (first2[i] < first1[i]) {
+        return false;
+      }
+    }
+  } else {
+    return std::lexicographical_compare(first1, last1, first2, last2);
+  }
+}
+
+// On random-access ranges, halve the range without branching on `comp`, so
+// that no step is mispredicted, and prefetch both candidates of the next
+// step, so that a long range costs about one cache miss per two steps.
+template <class ForwardIt, class T, class Compare>
+ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T &value,
+                      Compare comp) {
+  using Category = typename std::iterator_traits<ForwardIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::random_access_iterator_tag, Category>) {
+    auto n = last - first;
+    if (n == 0) {
+      return first;
+    }
+    while (n > 1) {
+      auto half = n / 2;
+      n -= half;
+      __builtin_prefetch(std::addressof(first[n / 2]));
+      __builtin_prefetch(std::addressof(first[half + n / 2]));
+      first = comp(first[half], value) ? first + half : first;
+    }
+    return first + comp(*first, value);
+  } else {
+    return std::lower_bound(first, last, value, comp);
+  }
+}
+template <class ForwardIt, class T>
+ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T &value) {
+  return abc::lower_bound(first, last, value, std::less<>());
+}
+template <class ForwardIt, class T, class Compare>
+ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T &value,
+                      Compare comp) {
+  using Category = typename std::iterator_traits<ForwardIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::random_access_iterator_tag, Category>) {
+    auto n = last - first;
+    if (n == 0) {
+      return first;
+    }
+    while (n > 1) {
+      auto half = n / 2;
+      n -= half;
+      __builtin_prefetch(std::addressof(first[n / 2]));
+      __builtin_prefetch(std::addressof(first[half + n / 2]));
+      first = comp(value, first[half]) ? first : first + half;
+    }
+    return first + !comp(value, *first);
+  } else {
+    return std::upper_bound(first, last, value, comp);
+  }
+}
+template <class ForwardIt, class T>
+ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T &value) {
+  return abc::upper_bound(first, last, value, std::less<>());
+}
+
+}  // namespace abc
+
+#endif  // ABC_ALGORITHM_H_
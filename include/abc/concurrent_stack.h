@@ -0,0 +1,190 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_CONCURRENT_STACK_H_
+#define ABC_CONCURRENT_STACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "abc/hazard_pointer.h"
+#include "abc/stats.h"
+#include "abc/utility.h"
+
+namespace abc {
+
+// The stack of Treiber (IBM RJ 5118, 1986), i.e. the `emplace_front()` and
+// `pop_front()` of abc::forward_list, made lock-free by CAS on the head.
+//
+// Popped nodes are retired to the stack and freed once no hazard pointer
+// protects them, so `try_pop()` never reads a freed node nor suffers ABA.
+// Any thread may call `push()`, `emplace()` and `try_pop()` at any time, so
+// the allocator must be thread-safe; the others need exclusive access.
+template <class T, class Allocator = std::allocator<T>>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+ private:
+  struct Node {
+    std::atomic<Node *> ptr_next;  // read by threads that lost the race
+    value_type value;
+    template <class... Args>
+    explicit Node(Args&&... args)
+        : ptr_next(nullptr), value(abc::forward<Args>(args)...) { }
+  };
+  using node_alloc_traits = typename std::allocator_traits<
+      Allocator>::template rebind_traits<Node>;
+  using NodeAllocator = typename node_alloc_traits::allocator_type;
+  // The top is stored together with the allocator, like forward_list's head.
+  struct Top : abc::ebo_storage<NodeAllocator> {
+    using abc::ebo_storage<NodeAllocator>::ebo_storage;
+    std::atomic<Node *> ptr_node{nullptr};
+  };
+  alignas(64) Top top_;
+  // Popped nodes that may still be protected, linked by `ptr_next`:
+  alignas(64) std::atomic<Node *> retired_{nullptr};
+  std::atomic<size_type> num_retired_{0};
+
+ public:
+  concurrent_stack() = default;
+  explicit concurrent_stack(const Allocator &alloc)
+      : top_(NodeAllocator(alloc)) {}
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack() noexcept {
+    delete_all(top_.ptr_node.load(std::memory_order_acquire));
+    delete_all(retired_.load(std::memory_order_acquire));
+  }
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(node_allocator());
+  }
+
+  // May be stale once returned, if other threads push or pop.
+  bool empty() const noexcept {
+    return !top_.ptr_node.load(std::memory_order_acquire);
+  }
+
+  template <class... Args>
+  void emplace(Args&&... args) {
+    auto ptr_new = new_node(abc::forward<Args>(args)...);
+    auto ptr_top = top_.ptr_node.load(std::memory_order_relaxed);
+    do {
+      ptr_new->ptr_next.store(ptr_top, std::memory_order_relaxed);
+    } while (!top_.ptr_node.compare_exchange_weak(ptr_top, ptr_new,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+  }
+  void push(const T &value) { emplace(value); }
+  void push(T &&value) { emplace(abc::move(value)); }
+
+  // Pop the top and return its value, or return `std::nullopt` if empty.
+  std::optional<T> try_pop() {
+    auto &hazard = internal::hazard_pointers::mine();
+    auto ptr_top = top_.ptr_node.load(std::memory_order_acquire);
+    while (ptr_top) {
+      hazard.store(ptr_top, std::memory_order_seq_cst);
+      // The top might have been freed before it was protected:
+      auto ptr_now = top_.ptr_node.load(std::memory_order_seq_cst);
+      if (ptr_now != ptr_top) {
+        ptr_top = ptr_now;
+        continue;
+      }
+      auto ptr_next = ptr_top->ptr_next.load(std::memory_order_relaxed);
+      // Ordered before the scan of hazard pointers in `reclaim()`:
+      if (top_.ptr_node.compare_exchange_weak(ptr_top, ptr_next,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_acquire)) {
+        break;
+      }
+    }
+    hazard.store(nullptr, std::memory_order_release);
+    if (!ptr_top) {
+      return std::nullopt;
+    }
+    // Other threads only read the link of a popped node, not its value:
+    auto value = std::optional<T>(abc::move(ptr_top->value));
+    retire(ptr_top);
+    return value;
+  }
+
+ private:
+  NodeAllocator &node_allocator() noexcept { return top_.get(); }
+  const NodeAllocator &node_allocator() const noexcept { return top_.get(); }
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s) noexcept { internal::count<concurrent_stack>(s); }
+  template <class... Args>
+  Node *new_node(Args&&... args) {
+    auto ptr_new = node_alloc_traits::allocate(node_allocator(), 1);
+    record(stat::kAllocations);
+    try {
+      node_alloc_traits::construct(node_allocator(), ptr_new,
+                                   abc::forward<Args>(args)...);
+    } catch (...) {
+      node_alloc_traits::deallocate(node_allocator(), ptr_new, 1);
+      record(stat::kDeallocations);
+      throw;
+    }
+    internal::count_construction<concurrent_stack, T, Args...>();
+    return ptr_new;
+  }
+  void delete_node(Node *ptr_old) noexcept {
+    node_alloc_traits::destroy(node_allocator(), ptr_old);
+    node_alloc_traits::deallocate(node_allocator(), ptr_old, 1);
+    record(stat::kDestructions);
+    record(stat::kDeallocations);
+  }
+  void delete_all(Node *ptr_node) noexcept {
+    while (ptr_node) {
+      auto ptr_next = ptr_node->ptr_next.load(std::memory_order_relaxed);
+      delete_node(ptr_node);
+      ptr_node = ptr_next;
+    }
+  }
+  void link_retired(Node *ptr_old) noexcept {
+    auto ptr_head = retired_.load(std::memory_order_relaxed);
+    do {
+      ptr_old->ptr_next.store(ptr_head, std::memory_order_relaxed);
+    } while (!retired_.compare_exchange_weak(ptr_head, ptr_old,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+  }
+  // Scan the hazard pointers once per (at least) twice as many retirements,
+  // so that each scan frees at least half of the nodes in amortized O(1).
+  void retire(Node *ptr_old) {
+    link_retired(ptr_old);
+    auto threshold = std::max<size_type>(
+        64, 2 * internal::hazard_pointers::instance().size());
+    if (num_retired_.fetch_add(1, std::memory_order_relaxed) + 1 >=
+        threshold) {
+      reclaim();
+    }
+  }
+  void reclaim() {
+    auto ptr_node = retired_.exchange(nullptr, std::memory_order_acquire);
+    if (!ptr_node) {
+      return;  // taken by another thread
+    }
+    auto hazards = internal::hazard_pointers::instance().snapshot();
+    size_type num_freed = 0;
+    while (ptr_node) {
+      auto ptr_next = ptr_node->ptr_next.load(std::memory_order_relaxed);
+      if (std::binary_search(hazards.begin(), hazards.end(), ptr_node)) {
+        link_retired(ptr_node);
+      } else {
+        delete_node(ptr_node);
+        ++num_freed;
+      }
+      ptr_node = ptr_next;
+    }
+    num_retired_.fetch_sub(num_freed, std::memory_order_relaxed);
+  }
+};  // concurrent_stack
+
+}  // namespace abc
+
+#endif  // ABC_CONCURRENT_STACK_H_
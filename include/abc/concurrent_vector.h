@@ -0,0 +1,347 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_CONCURRENT_VECTOR_H_
+#define ABC_CONCURRENT_VECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "abc/iterator.h"
+#include "abc/stats.h"
+#include "abc/utility.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// A vector that many threads may append to at once, whose elements never
+// move.  Its elements are stored in segments of 8, 16, 32, 64, ... slots, so
+// growing allocates a new segment instead of reallocating the old ones.
+//
+// Any thread may call `push_back()`, `emplace_back()` and `grow_by()` at any
+// time.  They claim slots by CAS on the size, after the segments of those
+// slots exist, so a throw changes nothing.  An element may be read by other
+// threads once its append has returned (e.g. after a join); `size()` counts
+// the slots claimed so far, some of which may still be under construction.
+// The others need exclusive access, and the allocator must be thread-safe.
+template <class T, class Allocator = std::allocator<T>>
+class concurrent_vector : private abc::ebo_storage<Allocator> {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "A claimed slot must not be left empty by a throw.");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using allocator_base = abc::ebo_storage<Allocator>;
+  // Elements that may throw on construction are staged here before claiming.
+  using buffer_type = abc::vector<T, Allocator>;
+  Allocator &allocator() noexcept { return allocator_base::get(); }
+  const Allocator &allocator() const noexcept {
+    return allocator_base::get();
+  }
+
+  // Segment `k` holds `kFirstSize << k` slots, starting at index
+  // `kFirstSize * (2^k - 1)`, so that `i + kFirstSize` tells both.
+  static constexpr int kLogFirstSize = 3;
+  static constexpr size_type kFirstSize = size_type(1) << kLogFirstSize;
+  static constexpr int kMaxSegments = 64 - kLogFirstSize;
+  static int segment_of(size_type i) noexcept {
+    return 63 - __builtin_clzll(i + kFirstSize) - kLogFirstSize;
+  }
+  static size_type segment_begin(int k) noexcept {
+    return kFirstSize * ((size_type(1) << k) - 1);
+  }
+  static size_type segment_size(int k) noexcept { return kFirstSize << k; }
+
+  std::atomic<T *> segments_[kMaxSegments]{};
+  alignas(64) std::atomic<size_type> size_{0};
+
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<concurrent_vector>(s, n);
+  }
+  // Return segment `k`, allocated by this thread if no other has done so.
+  T *make_segment(int k) {
+    auto *segment = segments_[k].load(std::memory_order_acquire);
+    if (segment) {
+      return segment;
+    }
+    auto *fresh = alloc_traits::allocate(allocator(), segment_size(k));
+    record(stat::kAllocations);
+    if (segments_[k].compare_exchange_strong(segment, fresh,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+      return fresh;
+    }
+    alloc_traits::deallocate(allocator(), fresh, segment_size(k));
+    record(stat::kDeallocations);
+    return segment;
+  }
+  // Claim `n` slots, whose segments are made before claiming, and return the
+  // index of the first one.
+  size_type claim(size_type n) {
+    auto first = size_.load(std::memory_order_relaxed);
+    do {
+      if (n) {
+        for (int k = segment_of(first), last = segment_of(first + n - 1);
+             k <= last; ++k) {
+          make_segment(k);
+        }
+      }
+    } while (!size_.compare_exchange_weak(first, first + n,
+                                          std::memory_order_relaxed,
+                                          std::memory_order_relaxed));
+    return first;
+  }
+  T *slot(size_type i) const noexcept {
+    auto k = segment_of(i);
+    return segments_[k].load(std::memory_order_acquire) +
+           (i - segment_begin(k));
+  }
+  // Move the elements of `buffer` to newly claimed slots.
+  size_type append(buffer_type &&buffer) {
+    auto first = claim(buffer.size());
+    for (size_type j = 0; j != buffer.size(); ++j) {
+      alloc_traits::construct(allocator(), slot(first + j),
+                              abc::move(buffer[j]));
+    }
+    record(stat::kMoves, buffer.size());
+    return first;
+  }
+
+ public:
+  // construction
+  concurrent_vector() = default;
+  explicit concurrent_vector(const Allocator &alloc)
+      : allocator_base(alloc) {}
+  // Not thread-safe, as is the destruction of `that`.
+  concurrent_vector(concurrent_vector &&that) noexcept
+      : allocator_base(abc::move(that.allocator())) {
+    for (int k = 0; k != kMaxSegments; ++k) {
+      segments_[k].store(that.segments_[k].exchange(nullptr));
+    }
+    size_.store(that.size_.exchange(0));
+  }
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(concurrent_vector &&) = delete;
+  ~concurrent_vector() noexcept {
+    clear();
+    for (int k = 0; k != kMaxSegments; ++k) {
+      if (auto *segment = segments_[k].load(std::memory_order_relaxed)) {
+        alloc_traits::deallocate(allocator(), segment, segment_size(k));
+        record(stat::kDeallocations);
+      }
+    }
+  }
+  allocator_type get_allocator() const noexcept { return allocator(); }
+
+  // iterators, which stay valid while the vector grows:
+  template <bool kConst>
+  class basic_iterator : public abc::iterator<
+      std::random_access_iterator_tag, T, difference_type,
+      std::conditional_t<kConst, const T *, T *>,
+      std::conditional_t<kConst, const T &, T &>> {
+    friend concurrent_vector;
+    template <bool> friend class basic_iterator;
+    using owner_pointer = std::conditional_t<kConst,
+        const concurrent_vector *, concurrent_vector *>;
+    owner_pointer owner_{nullptr};
+    size_type index_{0};
+
+   public:
+    using reference = std::conditional_t<kConst, const T &, T &>;
+    using pointer = std::conditional_t<kConst, const T *, T *>;
+    basic_iterator() = default;
+    basic_iterator(owner_pointer owner, size_type index) noexcept
+        : owner_(owner), index_(index) {}
+    // A mutable iterator converts to a const one:
+    template <bool kOther, class = std::enable_if_t<kConst && !kOther>>
+    basic_iterator(const basic_iterator<kOther> &that) noexcept  // NOLINT
+        : owner_(that.owner_), index_(that.index_) {}
+    reference operator*() const noexcept { return *owner_->slot(index_); }
+    pointer operator->() const noexcept { return owner_->slot(index_); }
+    reference operator[](difference_type n) const noexcept {
+      return *owner_->slot(index_ + n);
+    }
+    basic_iterator &operator++() noexcept { ++index_; return *this; }
+    basic_iterator &operator--() noexcept { --index_; return *this; }
+    basic_iterator operator++(int) noexcept {
+      auto old = *this;
+      ++index_;
+      return old;
+    }
+    basic_iterator operator--(int) noexcept {
+      auto old = *this;
+      --index_;
+      return old;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    friend basic_iterator operator+(basic_iterator it, difference_type n) {
+      return it += n;
+    }
+    friend basic_iterator operator+(difference_type n, basic_iterator it) {
+      return it += n;
+    }
+    friend basic_iterator operator-(basic_iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const basic_iterator &lhs,
+                                     const basic_iterator &rhs) noexcept {
+      return difference_type(lhs.index_) - difference_type(rhs.index_);
+    }
+    friend bool operator==(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.index_ == rhs.index_;
+    }
+    friend bool operator!=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.index_ != rhs.index_;
+    }
+    friend bool operator<(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return lhs.index_ < rhs.index_;
+    }
+    friend bool operator>(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return rhs < lhs;
+    }
+    friend bool operator<=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(rhs < lhs);
+    }
+    friend bool operator>=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(lhs < rhs);
+    }
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+
+  // non-modifying methods
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  size_type capacity() const noexcept {
+    int k = 0;
+    while (k != kMaxSegments &&
+           segments_[k].load(std::memory_order_relaxed)) {
+      ++k;
+    }
+    return segment_begin(k);
+  }
+  // element accessors (without check)
+  reference operator[](size_type pos) { return *slot(pos); }
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+  reference front() { return *slot(0); }
+  const_reference front() const { return *slot(0); }
+  reference back() { return *slot(size() - 1); }
+  const_reference back() const { return *slot(size() - 1); }
+  // element accessors (with check)
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return *slot(pos);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return *slot(pos);
+  }
+
+  // thread-safe appending methods, returning the (first) new element:
+  template <class... Args>
+  iterator emplace_back(Args &&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+      auto i = claim(1);
+      alloc_traits::construct(allocator(), slot(i),
+                              abc::forward<Args>(args)...);
+      internal::count_construction<concurrent_vector, T, Args...>();
+      return iterator(this, i);
+    } else {
+      // Construct it before claiming, so a throw leaves no empty slot:
+      auto value = T(abc::forward<Args>(args)...);
+      return emplace_back(abc::move(value));
+    }
+  }
+  iterator push_back(const T &value) { return emplace_back(value); }
+  iterator push_back(T &&value) { return emplace_back(abc::move(value)); }
+  // Append `count` copies of `value` (or of `T()`).
+  iterator grow_by(size_type count, const T &value = T()) {
+    if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+      auto first = claim(count);
+      for (size_type j = 0; j != count; ++j) {
+        alloc_traits::construct(allocator(), slot(first + j), value);
+      }
+      record(stat::kCopies, count);
+      return iterator(this, first);
+    } else {
+      return iterator(this, append(buffer_type(count, value, allocator())));
+    }
+  }
+  // Append copies of [first, last) next to each other.
+  template <class ForwardIt,
+            class = std::enable_if_t<abc::is_forward_iterator_v<ForwardIt>>>
+  iterator grow_by(ForwardIt first, ForwardIt last) {
+    using Ref = typename std::iterator_traits<ForwardIt>::reference;
+    if constexpr (std::is_nothrow_constructible_v<T, Ref>) {
+      auto i = claim(std::distance(first, last));
+      for (auto j = i; first != last; ++first, ++j) {
+        alloc_traits::construct(allocator(), slot(j), *first);
+        internal::count_construction<concurrent_vector, T, Ref>();
+      }
+      return iterator(this, i);
+    } else {
+      return iterator(this, append(buffer_type(first, last, allocator())));
+    }
+  }
+  iterator grow_by(std::initializer_list<T> init) {
+    return grow_by(init.begin(), init.end());
+  }
+
+  // Destroy all elements but keep the segments.  Not thread-safe.
+  void clear() noexcept {
+    auto n = size_.load(std::memory_order_relaxed);
+    for (size_type i = 0; i != n; ++i) {
+      alloc_traits::destroy(allocator(), slot(i));
+    }
+    record(stat::kDestructions, n);
+    size_.store(0, std::memory_order_relaxed);
+  }
+};  // concurrent_vector
+
+}  // namespace abc
+
+#endif  // ABC_CONCURRENT_VECTOR_H_
@@ -0,0 +1,527 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_DYNAMIC_BITSET_H_
+#define ABC_DYNAMIC_BITSET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/simd.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// A sequence of `size()` bits packed into 64-bit blocks, i.e. 1/8 of the
+// memory of `abc::vector<bool>`.  The bits past `size()` in the last block
+// are kept zero, so whole-block loops (`&=`, `count()`, `find_next()`, `==`)
+// need no masking but at the boundary.
+//
+// `operator[]` returns a proxy `reference`, as `std::vector<bool>` does.
+// Bulk operations work a block (or a SIMD register) at a time:
+//   - `&=`, `|=`, `^=`, `~` and `flip()` are plain loops over the blocks,
+//     which the compiler vectorizes;
+//   - `count()` runs the kernels of "abc/simd.h";
+//   - `set()`, `reset()` and `flip()` of `[pos, pos + count)` mask the two
+//     boundary blocks and fill the blocks between them;
+//   - `find_first()` and `find_next()` skip zero blocks and take the lowest
+//     set bit by `ctz`.
+template <class Allocator = std::allocator<std::uint64_t>>
+class dynamic_bitset {
+ public:
+  using block_type = std::uint64_t;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using value_type = bool;
+  using const_reference = bool;
+
+  static constexpr size_type kBlockBits = 64;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+ private:
+  using blocks_type = abc::vector<block_type, Allocator>;
+  static_assert(std::is_same_v<typename Allocator::value_type, block_type>);
+
+  static constexpr block_type kOnes = ~block_type(0);
+
+  static constexpr size_type blocks_for(size_type bits) noexcept {
+    return (bits + kBlockBits - 1) / kBlockBits;
+  }
+  static constexpr block_type bit(size_type pos) noexcept {
+    return block_type(1) << (pos % kBlockBits);
+  }
+
+ public:
+  // A proxy of the bit at `pos`, which reads and writes its block.
+  class reference {
+    friend class dynamic_bitset;
+    block_type *block_;
+    block_type mask_;
+
+    reference(block_type *block, block_type mask) noexcept
+        : block_(block), mask_(mask) {}
+
+   public:
+    reference(const reference &) = default;
+    reference &operator=(bool value) noexcept {
+      if (value) {
+        *block_ |= mask_;
+      } else {
+        *block_ &= ~mask_;
+      }
+      return *this;
+    }
+    reference &operator=(const reference &that) noexcept {
+      return *this = static_cast<bool>(that);
+    }
+    operator bool() const noexcept { return (*block_ & mask_) != 0; }
+    bool operator~() const noexcept { return (*block_ & mask_) == 0; }
+    reference &flip() noexcept {
+      *block_ ^= mask_;
+      return *this;
+    }
+  };
+
+ private:
+  template <bool kConst>
+  class basic_iterator {
+    friend class dynamic_bitset;
+    using block_pointer = std::conditional_t<kConst,
+        const block_type *, block_type *>;
+    block_pointer blocks_{nullptr};
+    std::ptrdiff_t pos_{0};
+
+    basic_iterator(block_pointer blocks, std::ptrdiff_t pos) noexcept
+        : blocks_(blocks), pos_(pos) {}
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<kConst, bool,
+        typename dynamic_bitset::reference>;
+    using pointer = void;
+
+    basic_iterator() noexcept = default;
+    // Allow `iterator` to `const_iterator` conversion.
+    template <bool kThatConst,
+              class = std::enable_if_t<kConst && !kThatConst>>
+    basic_iterator(const basic_iterator<kThatConst> &that) noexcept
+        : blocks_(that.blocks_), pos_(that.pos_) {}
+
+    reference operator*() const noexcept {
+      auto *block = blocks_ + pos_ / kBlockBits;
+      if constexpr (kConst) {
+        return (*block & bit(pos_)) != 0;
+      } else {
+        return reference(block, bit(pos_));
+      }
+    }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+    basic_iterator &operator++() noexcept { ++pos_; return *this; }
+    basic_iterator operator++(int) noexcept { return {blocks_, pos_++}; }
+    basic_iterator &operator--() noexcept { --pos_; return *this; }
+    basic_iterator operator--(int) noexcept { return {blocks_, pos_--}; }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend basic_iterator operator+(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator+(difference_type n,
+                                    basic_iterator iter) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator-(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter -= n;
+    }
+    friend difference_type operator-(const basic_iterator &lhs,
+                                     const basic_iterator &rhs) noexcept {
+      return lhs.pos_ - rhs.pos_;
+    }
+    friend bool operator==(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.pos_ == rhs.pos_;
+    }
+    friend bool operator!=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.pos_ != rhs.pos_;
+    }
+    friend bool operator<(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return lhs.pos_ < rhs.pos_;
+    }
+    friend bool operator>(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return rhs < lhs;
+    }
+    friend bool operator<=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(rhs < lhs);
+    }
+    friend bool operator>=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(lhs < rhs);
+    }
+  };
+
+ public:
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  // construction
+  dynamic_bitset() = default;
+  explicit dynamic_bitset(const Allocator &alloc) : blocks_(alloc) {}
+  explicit dynamic_bitset(size_type count, bool value = false,
+                          const Allocator &alloc = Allocator())
+      : blocks_(blocks_for(count), value ? kOnes : 0, alloc), size_(count) {
+    trim();
+  }
+  dynamic_bitset(std::initializer_list<bool> init,
+                 const Allocator &alloc = Allocator())
+      : dynamic_bitset(init.size(), false, alloc) {
+    size_type pos = 0;
+    for (bool value : init) {
+      if (value) {
+        blocks_[pos / kBlockBits] |= bit(pos);
+      }
+      ++pos;
+    }
+  }
+  // copy operations:
+  dynamic_bitset(const dynamic_bitset &) = default;
+  dynamic_bitset &operator=(const dynamic_bitset &) = default;
+  // move operations:
+  dynamic_bitset(dynamic_bitset &&that) noexcept
+      : blocks_(std::move(that.blocks_)), size_(std::exchange(that.size_, 0)) {
+  }
+  dynamic_bitset &operator=(dynamic_bitset &&that) noexcept(
+      std::is_nothrow_move_assignable_v<blocks_type>) {
+    if (this != &that) {
+      blocks_ = std::move(that.blocks_);
+      size_ = std::exchange(that.size_, 0);
+    }
+    return *this;
+  }
+  ~dynamic_bitset() noexcept = default;
+  allocator_type get_allocator() const noexcept {
+    return blocks_.get_allocator();
+  }
+
+  // iterator and related methods
+  iterator begin() noexcept { return {blocks_.data(), 0}; }
+  iterator end() noexcept { return {blocks_.data(), ptrdiff(size_)}; }
+  const_iterator cbegin() const noexcept { return {blocks_.data(), 0}; }
+  const_iterator cend() const noexcept {
+    return {blocks_.data(), ptrdiff(size_)};
+  }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+
+  // non-modifying methods
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept {
+    return blocks_.capacity() * kBlockBits;
+  }
+  size_type num_blocks() const noexcept { return blocks_.size(); }
+  const block_type *data() const noexcept { return blocks_.data(); }
+  // element accessors (without check)
+  reference operator[](size_type pos) noexcept {
+    return reference(&blocks_[pos / kBlockBits], bit(pos));
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    return (blocks_[pos / kBlockBits] & bit(pos)) != 0;
+  }
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size_ - 1]; }
+  const_reference back() const noexcept { return (*this)[size_ - 1]; }
+  // element accessors (with check)
+  reference at(size_type pos) {
+    check_index(pos);
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    check_index(pos);
+    return (*this)[pos];
+  }
+  bool test(size_type pos) const { return at(pos); }
+  // Whether all, any or none of the bits are set.
+  bool all() const noexcept {
+    auto full = size_ / kBlockBits;
+    for (size_type i = 0; i != full; ++i) {
+      if (blocks_[i] != kOnes) {
+        return false;
+      }
+    }
+    return full == blocks_.size() || blocks_[full] == bit(size_) - 1;
+  }
+  bool any() const noexcept {
+    for (auto block : blocks_) {
+      if (block) {
+        return true;
+      }
+    }
+    return false;
+  }
+  bool none() const noexcept { return !any(); }
+  // Return the number of set bits.
+  size_type count() const noexcept {
+    return simd::popcount(blocks_.data(), blocks_.size());
+  }
+  // Return the position of the first set bit, or `npos` if there is none.
+  size_type find_first() const noexcept {
+    return find_from_block(0);
+  }
+  // Return the position of the first set bit after `pos`, or `npos`.
+  size_type find_next(size_type pos) const noexcept {
+    if (pos >= size_ || ++pos == size_) {
+      return npos;
+    }
+    auto i = pos / kBlockBits;
+    if (auto block = blocks_[i] & (kOnes << (pos % kBlockBits))) {
+      return i * kBlockBits + __builtin_ctzll(block);
+    }
+    return find_from_block(i + 1);
+  }
+
+  // capacity methods
+  void reserve(size_type new_capacity) {
+    blocks_.reserve(blocks_for(new_capacity));
+  }
+  void shrink_to_fit() {
+    blocks_.shrink_to_fit();
+  }
+  // modifying methods
+  void resize(size_type count, bool value = false) {
+    if (count > size_) {
+      auto old_size = size_;
+      blocks_.resize(blocks_for(count), value ? kOnes : 0);
+      size_ = count;
+      if (value && old_size % kBlockBits) {
+        blocks_[old_size / kBlockBits] |= kOnes << (old_size % kBlockBits);
+      }
+    } else {
+      blocks_.resize(blocks_for(count));
+      size_ = count;
+    }
+    trim();
+  }
+  void push_back(bool value) {
+    if (size_ % kBlockBits == 0) {
+      blocks_.emplace_back(0);
+    }
+    if (value) {
+      blocks_.back() |= bit(size_);
+    }
+    ++size_;
+  }
+  void pop_back() {
+    --size_;
+    if (size_ % kBlockBits == 0) {
+      blocks_.pop_back();
+    } else {
+      blocks_.back() &= ~bit(size_);
+    }
+  }
+  void clear() noexcept {
+    blocks_.clear();
+    size_ = 0;
+  }
+  void swap(dynamic_bitset &that) noexcept {
+    blocks_.swap(that.blocks_);
+    std::swap(size_, that.size_);
+  }
+  // Set, reset or flip all bits.
+  dynamic_bitset &set() noexcept {
+    std::fill(blocks_.begin(), blocks_.end(), kOnes);
+    trim();
+    return *this;
+  }
+  dynamic_bitset &reset() noexcept {
+    std::fill(blocks_.begin(), blocks_.end(), block_type(0));
+    return *this;
+  }
+  dynamic_bitset &flip() noexcept {
+    for (auto &block : blocks_) {
+      block = ~block;
+    }
+    trim();
+    return *this;
+  }
+  // Set, reset or flip the bit at `pos`.
+  dynamic_bitset &set(size_type pos, bool value = true) {
+    at(pos) = value;
+    return *this;
+  }
+  dynamic_bitset &reset(size_type pos) {
+    return set(pos, false);
+  }
+  dynamic_bitset &flip(size_type pos) {
+    at(pos).flip();
+    return *this;
+  }
+  // Set, reset or flip the bits in `[pos, pos + count)`.
+  dynamic_bitset &set(size_type pos, size_type count, bool value) {
+    if (value) {
+      for_each_block(pos, count, [](block_type &block, block_type mask) {
+        block |= mask;
+      });
+    } else {
+      for_each_block(pos, count, [](block_type &block, block_type mask) {
+        block &= ~mask;
+      });
+    }
+    return *this;
+  }
+  dynamic_bitset &reset(size_type pos, size_type count) {
+    return set(pos, count, false);
+  }
+  dynamic_bitset &flip(size_type pos, size_type count) {
+    for_each_block(pos, count, [](block_type &block, block_type mask) {
+      block ^= mask;
+    });
+    return *this;
+  }
+  // Combine with another bitset of the same size, a block at a time.
+  dynamic_bitset &operator&=(const dynamic_bitset &that) {
+    return combine(that, [](block_type a, block_type b) { return a & b; });
+  }
+  dynamic_bitset &operator|=(const dynamic_bitset &that) {
+    return combine(that, [](block_type a, block_type b) { return a | b; });
+  }
+  dynamic_bitset &operator^=(const dynamic_bitset &that) {
+    return combine(that, [](block_type a, block_type b) { return a ^ b; });
+  }
+  dynamic_bitset operator~() const {
+    auto copy = *this;
+    copy.flip();
+    return copy;
+  }
+
+ private:  // Data members:
+  blocks_type blocks_;
+  size_type size_{0};
+
+ private:
+  static std::ptrdiff_t ptrdiff(size_type n) noexcept {
+    return static_cast<std::ptrdiff_t>(n);
+  }
+  void check_index(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+  }
+  // Clear the bits past `size()` in the last block.
+  void trim() noexcept {
+    if (size_ % kBlockBits) {
+      blocks_.back() &= bit(size_) - 1;
+    }
+  }
+  size_type find_from_block(size_type i) const noexcept {
+    for (auto n = blocks_.size(); i < n; ++i) {
+      if (auto block = blocks_[i]) {
+        return i * kBlockBits + __builtin_ctzll(block);
+      }
+    }
+    return npos;
+  }
+  // Call `apply(block, mask)` on each block that overlaps
+  // `[pos, pos + count)`, where `mask` selects the overlapped bits.
+  template <class Apply>
+  void for_each_block(size_type pos, size_type count, Apply &&apply) {
+    if (pos > size_ || count > size_ - pos) {
+      throw std::out_of_range("The given range is illegal!");
+    }
+    if (count == 0) {
+      return;
+    }
+    auto last = pos + count - 1;
+    auto i = pos / kBlockBits, j = last / kBlockBits;
+    auto head = kOnes << (pos % kBlockBits);
+    auto tail = kOnes >> (kBlockBits - 1 - last % kBlockBits);
+    if (i == j) {
+      apply(blocks_[i], head & tail);
+      return;
+    }
+    auto *blocks = blocks_.data();
+    apply(blocks[i], head);
+    for (++i; i != j; ++i) {
+      apply(blocks[i], kOnes);
+    }
+    apply(blocks[j], tail);
+  }
+  template <class Op>
+  dynamic_bitset &combine(const dynamic_bitset &that, Op &&op) {
+    if (size_ != that.size_) {
+      throw std::invalid_argument("The given bitsets differ in size!");
+    }
+    auto *a = blocks_.data();
+    auto *b = that.blocks_.data();
+    for (size_type i = 0, n = blocks_.size(); i != n; ++i) {
+      a[i] = op(a[i], b[i]);
+    }
+    return *this;
+  }
+};
+
+template <class Allocator>
+dynamic_bitset<Allocator> operator&(const dynamic_bitset<Allocator> &lhs,
+                                    const dynamic_bitset<Allocator> &rhs) {
+  auto result = lhs;
+  result &= rhs;
+  return result;
+}
+template <class Allocator>
+dynamic_bitset<Allocator> operator|(const dynamic_bitset<Allocator> &lhs,
+                                    const dynamic_bitset<Allocator> &rhs) {
+  auto result = lhs;
+  result |= rhs;
+  return result;
+}
+template <class Allocator>
+dynamic_bitset<Allocator> operator^(const dynamic_bitset<Allocator> &lhs,
+                                    const dynamic_bitset<Allocator> &rhs) {
+  auto result = lhs;
+  result ^= rhs;
+  return result;
+}
+// Bitsets of the same size are compared a block at a time, which is exact
+// because the bits past `size()` are zero in both.
+template <class Allocator>
+bool operator==(const dynamic_bitset<Allocator> &lhs,
+                const dynamic_bitset<Allocator> &rhs) noexcept {
+  return lhs.size() == rhs.size() &&
+      abc::equal(lhs.data(), lhs.data() + lhs.num_blocks(),
+                 rhs.data(), rhs.data() + rhs.num_blocks());
+}
+template <class Allocator>
+bool operator!=(const dynamic_bitset<Allocator> &lhs,
+                const dynamic_bitset<Allocator> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+template <class Allocator>
+void swap(dynamic_bitset<Allocator> &lhs,
+          dynamic_bitset<Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_DYNAMIC_BITSET_H_
@@ -0,0 +1,56 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_EXECUTION_H_
+#define ABC_EXECUTION_H_
+
+#include <type_traits>
+
+#include "abc/thread_pool.h"
+
+namespace abc {
+namespace execution {
+
+// Run an algorithm on the calling thread.
+class sequenced_policy {};
+
+// Run an algorithm in chunks on `abc::thread_pool::instance()`, or on the
+// pool given by `on()`, e.g. `abc::execution::par.on(pool)`.
+class parallel_policy {
+ public:
+  constexpr parallel_policy() noexcept = default;
+  constexpr explicit parallel_policy(thread_pool *pool) noexcept
+      : pool_(pool) {}
+  parallel_policy on(thread_pool &pool) const noexcept {
+    return parallel_policy(&pool);
+  }
+  thread_pool &pool() const { return pool_ ? *pool_ : thread_pool::instance(); }
+
+ private:
+  thread_pool *pool_{nullptr};
+};
+
+// Also allow the calls in a chunk to be interleaved.  Chunks of contiguous
+// ranges are vectorized by the compiler where it can, so this runs as `par`.
+class parallel_unsequenced_policy : public parallel_policy {
+ public:
+  using parallel_policy::parallel_policy;
+  parallel_unsequenced_policy on(thread_pool &pool) const noexcept {  // NOLINT
+    return parallel_unsequenced_policy(&pool);
+  }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+}  // namespace execution
+
+template <class T>
+struct is_execution_policy : std::bool_constant<
+    std::is_same_v<T, execution::sequenced_policy> ||
+    std::is_base_of_v<execution::parallel_policy, T>> {};
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+}  // namespace abc
+
+#endif  // ABC_EXECUTION_H_
@@ -0,0 +1,72 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_FLAT_HASH_MAP_H_
+#define ABC_FLAT_HASH_MAP_H_
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "abc/hash_table.h"
+
+namespace abc {
+namespace internal {
+
+// How an abc::flat_hash_map holds a `std::pair<const K, V>` in a slot.  The
+// pair is relocated through a `std::pair<K, V>` sharing the same storage,
+// so that the key is moved instead of copied.
+template <class K, class V>
+struct map_policy {
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using mutable_value_type = std::pair<K, V>;
+  static constexpr bool kConstElements = false;
+
+  union slot_type {
+    value_type value;
+    mutable_value_type mutable_value;
+    slot_type() {}
+    ~slot_type() {}
+  };
+
+  static const K &key(const value_type &value) noexcept {
+    return value.first;
+  }
+  static value_type &element(slot_type *slot) noexcept {
+    return slot->value;
+  }
+  template <class Allocator, class... Args>
+  static void construct(Allocator &alloc, slot_type *slot, Args &&...args) {
+    std::allocator_traits<Allocator>::construct(alloc, &slot->value,
+                                                std::forward<Args>(args)...);
+  }
+  template <class Allocator>
+  static void destroy(Allocator &alloc, slot_type *slot) noexcept {
+    std::allocator_traits<Allocator>::destroy(alloc, &slot->value);
+  }
+  template <class Allocator>
+  static void transfer(Allocator &alloc, slot_type *to,
+                       slot_type *from) noexcept {
+    std::allocator_traits<Allocator>::construct(
+        alloc, &to->mutable_value, std::move(from->mutable_value));
+    std::allocator_traits<Allocator>::destroy(alloc, &from->mutable_value);
+  }
+};
+
+}  // namespace internal
+
+// An unordered map storing its elements in one flat array (see
+// "abc/hash_table.h"), so an insert or erase may move other elements and
+// invalidate references to them, unlike `std::unordered_map`.
+//
+// A transparent `Hash` and `KeyEqual` (e.g. `std::equal_to<>`) enable
+// lookups by any type that they accept, without constructing a `K`.
+template <class K, class V, class Hash = std::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          class Allocator = std::allocator<std::pair<const K, V>>>
+using flat_hash_map = internal::hash_table<internal::map_policy<K, V>, Hash,
+                                           KeyEqual, Allocator>;
+
+}  // namespace abc
+
+#endif  // ABC_FLAT_HASH_MAP_H_
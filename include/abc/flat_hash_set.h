@@ -0,0 +1,58 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_FLAT_HASH_SET_H_
+#define ABC_FLAT_HASH_SET_H_
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "abc/hash_table.h"
+
+namespace abc {
+namespace internal {
+
+// How an abc::flat_hash_set holds a `K` in a slot.
+template <class K>
+struct set_policy {
+  using key_type = K;
+  using value_type = K;
+  using mutable_value_type = K;
+  static constexpr bool kConstElements = true;
+
+  using slot_type = K;
+
+  static const K &key(const K &value) noexcept { return value; }
+  static K &element(slot_type *slot) noexcept { return *slot; }
+  template <class Allocator, class... Args>
+  static void construct(Allocator &alloc, slot_type *slot, Args &&...args) {
+    std::allocator_traits<Allocator>::construct(alloc, slot,
+                                                std::forward<Args>(args)...);
+  }
+  template <class Allocator>
+  static void destroy(Allocator &alloc, slot_type *slot) noexcept {
+    std::allocator_traits<Allocator>::destroy(alloc, slot);
+  }
+  template <class Allocator>
+  static void transfer(Allocator &alloc, slot_type *to,
+                       slot_type *from) noexcept {
+    std::allocator_traits<Allocator>::construct(alloc, to, std::move(*from));
+    std::allocator_traits<Allocator>::destroy(alloc, from);
+  }
+};
+
+}  // namespace internal
+
+// An unordered set storing its elements in one flat array (see
+// "abc/hash_table.h"), so an insert or erase may move other elements.
+//
+// A transparent `Hash` and `KeyEqual` (e.g. `std::equal_to<>`) enable
+// lookups by any type that they accept, without constructing a `K`.
+template <class K, class Hash = std::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          class Allocator = std::allocator<K>>
+using flat_hash_set = internal::hash_table<internal::set_policy<K>, Hash,
+                                           KeyEqual, Allocator>;
+
+}  // namespace abc
+
+#endif  // ABC_FLAT_HASH_SET_H_
@@ -0,0 +1,532 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_FLAT_MAP_H_
+#define ABC_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/flat_set.h"
+#include "abc/iterator.h"
+#include "abc/utility.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// A map of unique keys sorted in one contiguous `KeyContainer`, whose mapped
+// values are stored at the same indices in another `MappedContainer`, so a
+// lookup by abc::lower_bound (branchless and prefetching) only touches keys.
+// Inserting or erasing an element moves the elements after it, so it suits
+// tables that are built in bulk and read often.
+//
+// Inserting a range stages and sorts the new elements, then merges them with
+// the old ones in a single pass, instead of moving the old elements once per
+// element.  An iterator yields a `std::pair<const Key &, T &>` by value.
+template <class Key, class T, class Compare = std::less<Key>,
+          class KeyContainer = abc::vector<Key>,
+          class MappedContainer = abc::vector<T>>
+class flat_map : private abc::ebo_storage<Compare> {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using key_compare = Compare;
+  using reference = std::pair<const Key &, T &>;
+  using const_reference = std::pair<const Key &, const T &>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_container_type = KeyContainer;
+  using mapped_container_type = MappedContainer;
+  struct containers {
+    KeyContainer keys;
+    MappedContainer values;
+  };
+
+  template <bool kConst>
+  class basic_iterator {
+    friend class flat_map;
+    template <bool> friend class basic_iterator;
+    using key_iter = typename KeyContainer::const_iterator;
+    using mapped_iter = std::conditional_t<kConst,
+        typename MappedContainer::const_iterator,
+        typename MappedContainer::iterator>;
+    key_iter key_{};
+    mapped_iter mapped_{};
+
+    basic_iterator(key_iter key, mapped_iter mapped) noexcept
+        : key_(key), mapped_(mapped) {}
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename flat_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<kConst, const_reference,
+                                         typename flat_map::reference>;
+    // `iter->second` is reached through a proxy holding `*iter`.
+    struct pointer {
+      reference ref;
+      const reference *operator->() const noexcept { return &ref; }
+    };
+
+    basic_iterator() noexcept = default;
+    template <bool kOtherConst,
+              class = std::enable_if_t<kConst && !kOtherConst>>
+    basic_iterator(const basic_iterator<kOtherConst> &that) noexcept  // NOLINT
+        : key_(that.key_), mapped_(that.mapped_) {}
+
+    reference operator*() const noexcept { return {*key_, *mapped_}; }
+    pointer operator->() const noexcept { return {**this}; }
+    reference operator[](difference_type n) const noexcept {
+      return {key_[n], mapped_[n]};
+    }
+    basic_iterator &operator++() noexcept { return *this += 1; }
+    basic_iterator operator++(int) noexcept {
+      auto old = *this;
+      *this += 1;
+      return old;
+    }
+    basic_iterator &operator--() noexcept { return *this -= 1; }
+    basic_iterator operator--(int) noexcept {
+      auto old = *this;
+      *this -= 1;
+      return old;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      key_ += n;
+      mapped_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      return *this += -n;
+    }
+    friend basic_iterator operator+(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator+(difference_type n,
+                                    basic_iterator iter) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator-(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter -= n;
+    }
+    friend difference_type operator-(const basic_iterator &lhs,
+                                     const basic_iterator &rhs) noexcept {
+      return lhs.key_ - rhs.key_;
+    }
+    friend bool operator==(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.key_ == rhs.key_;
+    }
+    friend bool operator!=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.key_ != rhs.key_;
+    }
+    friend bool operator<(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return lhs.key_ < rhs.key_;
+    }
+    friend bool operator>(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return rhs < lhs;
+    }
+    friend bool operator<=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(rhs < lhs);
+    }
+    friend bool operator>=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(lhs < rhs);
+    }
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+ private:
+  using compare_base = abc::ebo_storage<Compare>;
+  const Compare &compare() const noexcept { return compare_base::get(); }
+
+ public:
+  // construction
+  flat_map() = default;
+  explicit flat_map(const Compare &comp) : compare_base(comp) {}
+  flat_map(KeyContainer keys, MappedContainer values,
+           const Compare &comp = Compare())
+      : compare_base(comp), keys_(abc::move(keys)),
+        values_(abc::move(values)) {
+    sort_and_unique();
+  }
+  flat_map(sorted_unique_t, KeyContainer keys, MappedContainer values,
+           const Compare &comp = Compare())
+      : compare_base(comp), keys_(abc::move(keys)),
+        values_(abc::move(values)) {}
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  flat_map(InputIt first, InputIt last, const Compare &comp = Compare())
+      : compare_base(comp) {
+    insert(first, last);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  flat_map(sorted_unique_t, InputIt first, InputIt last,
+           const Compare &comp = Compare())
+      : compare_base(comp) {
+    insert(sorted_unique, first, last);
+  }
+  flat_map(std::initializer_list<value_type> init,
+           const Compare &comp = Compare())
+      : flat_map(init.begin(), init.end(), comp) {}
+  flat_map(sorted_unique_t, std::initializer_list<value_type> init,
+           const Compare &comp = Compare())
+      : flat_map(sorted_unique, init.begin(), init.end(), comp) {}
+  flat_map &operator=(std::initializer_list<value_type> init) {
+    clear();
+    insert(init);
+    return *this;
+  }
+
+  // iterators
+  iterator begin() noexcept { return {keys_.cbegin(), values_.begin()}; }
+  const_iterator begin() const noexcept {
+    return {keys_.cbegin(), values_.cbegin()};
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return {keys_.cend(), values_.end()}; }
+  const_iterator end() const noexcept {
+    return {keys_.cend(), values_.cend()};
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  // capacity
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type capacity() const noexcept { return keys_.capacity(); }
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+  void shrink_to_fit() {
+    keys_.shrink_to_fit();
+    values_.shrink_to_fit();
+  }
+
+  // observers
+  key_compare key_comp() const { return compare(); }
+  const KeyContainer &keys() const noexcept { return keys_; }
+  const MappedContainer &values() const noexcept { return values_; }
+  // Take the containers out, leaving this map empty.
+  containers extract() && {
+    auto result = containers{abc::move(keys_), abc::move(values_)};
+    clear();
+    return result;
+  }
+  // Replace the containers by `keys`, which are sorted and unique, and
+  // `values` of the same size.
+  void replace(KeyContainer &&keys, MappedContainer &&values) {
+    keys_ = abc::move(keys);
+    values_ = abc::move(values);
+  }
+
+  // element access
+  T &operator[](const Key &key) { return try_emplace(key).first->second; }
+  T &operator[](Key &&key) {
+    return try_emplace(abc::move(key)).first->second;
+  }
+  T &at(const Key &key) { return values_[index_of(key)]; }
+  const T &at(const Key &key) const { return values_[index_of(key)]; }
+
+  // lookup
+  iterator lower_bound(const Key &key) { return at_index(lower_index(key)); }
+  const_iterator lower_bound(const Key &key) const {
+    return at_index(lower_index(key));
+  }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  iterator lower_bound(const K &key) { return at_index(lower_index(key)); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  const_iterator lower_bound(const K &key) const {
+    return at_index(lower_index(key));
+  }
+  iterator upper_bound(const Key &key) { return at_index(upper_index(key)); }
+  const_iterator upper_bound(const Key &key) const {
+    return at_index(upper_index(key));
+  }
+  iterator find(const Key &key) { return at_index(find_index(key)); }
+  const_iterator find(const Key &key) const {
+    return at_index(find_index(key));
+  }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  iterator find(const K &key) { return at_index(find_index(key)); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  const_iterator find(const K &key) const {
+    return at_index(find_index(key));
+  }
+  bool contains(const Key &key) const { return find_index(key) != size(); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  bool contains(const K &key) const { return find_index(key) != size(); }
+  size_type count(const Key &key) const { return contains(key); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  size_type count(const K &key) const { return contains(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    auto i = find_index(key);
+    return i == size() ? std::make_pair(lower_bound(key), lower_bound(key))
+                       : std::make_pair(at_index(i), at_index(i + 1));
+  }
+
+  // modifiers
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return emplace_at(lower_index(key), key, std::forward<Args>(args)...);
+  }
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+    return emplace_at(lower_index(key), abc::move(key),
+                      std::forward<Args>(args)...);
+  }
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj) {
+    auto result = try_emplace(abc::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    auto value = value_type(std::forward<Args>(args)...);
+    return try_emplace(abc::move(value.first), abc::move(value.second));
+  }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return try_emplace(abc::move(value.first), abc::move(value.second));
+  }
+  // Insert the elements in [first, last) whose keys are absent, by one merge.
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void insert(InputIt first, InputIt last) {
+    auto staged = abc::vector<value_type>(first, last);
+    std::stable_sort(staged.begin(), staged.end(),
+        [this](const value_type &a, const value_type &b) {
+          return compare()(a.first, b.first);
+        });
+    merge(&staged);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void insert(sorted_unique_t, InputIt first, InputIt last) {
+    auto staged = abc::vector<value_type>(first, last);
+    merge(&staged);
+  }
+  void insert(std::initializer_list<value_type> init) {
+    insert(init.begin(), init.end());
+  }
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+  iterator erase(const_iterator first, const_iterator last) {
+    auto i = first.key_ - keys_.cbegin(), j = last.key_ - keys_.cbegin();
+    keys_.erase(keys_.begin() + i, keys_.begin() + j);
+    values_.erase(values_.begin() + i, values_.begin() + j);
+    return at_index(i);
+  }
+  size_type erase(const Key &key) {
+    auto i = find_index(key);
+    if (i == size()) {
+      return 0;
+    }
+    erase(at_index(i));
+    return 1;
+  }
+  // Erase the elements that satisfy `pred`, which is given a
+  // `const_reference`, and return how many are erased.
+  template <class Predicate>
+  size_type erase_if(Predicate pred) {
+    size_type kept = 0, n = size();
+    for (size_type i = 0; i != n; ++i) {
+      if (!pred(const_reference(keys_[i], values_[i]))) {
+        if (kept != i) {
+          keys_[kept] = abc::move(keys_[i]);
+          values_[kept] = abc::move(values_[i]);
+        }
+        ++kept;
+      }
+    }
+    keys_.erase(keys_.begin() + kept, keys_.end());
+    values_.erase(values_.begin() + kept, values_.end());
+    return n - kept;
+  }
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+  void swap(flat_map &other) noexcept {
+    using std::swap;
+    swap(compare_base::get(), other.compare_base::get());
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+  }
+
+ private:
+  iterator at_index(size_type i) noexcept {
+    return {keys_.cbegin() + i, values_.begin() + i};
+  }
+  const_iterator at_index(size_type i) const noexcept {
+    return {keys_.cbegin() + i, values_.cbegin() + i};
+  }
+  template <class K>
+  size_type lower_index(const K &key) const {
+    return abc::lower_bound(keys_.begin(), keys_.end(), key, compare()) -
+           keys_.begin();
+  }
+  template <class K>
+  size_type upper_index(const K &key) const {
+    return abc::upper_bound(keys_.begin(), keys_.end(), key, compare()) -
+           keys_.begin();
+  }
+  // Return the index of `key`, or `size()` if it is absent.
+  template <class K>
+  size_type find_index(const K &key) const {
+    auto i = lower_index(key);
+    return i != size() && !compare()(key, keys_[i]) ? i : size();
+  }
+  size_type index_of(const Key &key) const {
+    auto i = find_index(key);
+    if (i == size()) {
+      throw std::out_of_range("The given key is absent!");
+    }
+    return i;
+  }
+  // Insert the element of `key` at `i`, unless `key` is already there.  If
+  // the mapped value throws, the key is erased again.
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace_at(size_type i, K &&key,
+                                       Args &&...args) {
+    if (i != size() && !compare()(key, keys_[i])) {
+      return {at_index(i), false};
+    }
+    keys_.insert(keys_.begin() + i, std::forward<K>(key));
+    try {
+      values_.emplace(values_.begin() + i, std::forward<Args>(args)...);
+    } catch (...) {
+      keys_.erase(keys_.begin() + i);
+      throw;
+    }
+    return {at_index(i), true};
+  }
+  // Sort the elements by keys, through a permutation since they are held in
+  // two containers, and keep the first of equivalent keys.
+  void sort_and_unique() {
+    auto n = keys_.size();
+    auto order = abc::vector<size_type>(n);
+    std::iota(order.begin(), order.end(), size_type(0));
+    if (!std::is_sorted(keys_.begin(), keys_.end(), compare())) {
+      std::stable_sort(order.begin(), order.end(),
+          [this](size_type a, size_type b) {
+            return compare()(keys_[a], keys_[b]);
+          });
+    }
+    auto keys = KeyContainer();
+    auto values = MappedContainer();
+    keys.reserve(n);
+    values.reserve(n);
+    for (auto i : order) {
+      if (keys.empty() || compare()(keys.back(), keys_[i])) {
+        keys.push_back(std::move_if_noexcept(keys_[i]));
+        values.push_back(std::move_if_noexcept(values_[i]));
+      }
+    }
+    keys_ = abc::move(keys);
+    values_ = abc::move(values);
+  }
+  // Merge the elements in `staged`, sorted by keys, into the containers,
+  // keeping the first of equivalent keys.  Elements after all the old ones
+  // are simply appended.
+  void merge(abc::vector<value_type> *staged) {
+    auto b = staged->begin(), b_end = staged->end();
+    if (keys_.empty() || (b != b_end && compare()(keys_.back(), b->first))) {
+      reserve(size() + staged->size());
+      for (; b != b_end; ++b) {
+        if (keys_.empty() || compare()(keys_.back(), b->first)) {
+          keys_.push_back(std::move_if_noexcept(b->first));
+          values_.push_back(std::move_if_noexcept(b->second));
+        }
+      }
+      return;
+    }
+    auto keys = KeyContainer();
+    auto values = MappedContainer();
+    keys.reserve(size() + staged->size());
+    values.reserve(size() + staged->size());
+    size_type a = 0, a_end = size();
+    // `keys.back()` is the last key taken, so a staged duplicate of it is
+    // skipped:
+    auto take_staged = [&]() {
+      if (keys.empty() || compare()(keys.back(), b->first)) {
+        keys.push_back(std::move_if_noexcept(b->first));
+        values.push_back(std::move_if_noexcept(b->second));
+      }
+      ++b;
+    };
+    auto take_old = [&]() {
+      keys.push_back(std::move_if_noexcept(keys_[a]));
+      values.push_back(std::move_if_noexcept(values_[a]));
+      ++a;
+    };
+    while (a != a_end && b != b_end) {
+      if (compare()(b->first, keys_[a])) {
+        take_staged();
+      } else {
+        if (!compare()(keys_[a], b->first)) {
+          ++b;  // the old element is kept
+        }
+        take_old();
+      }
+    }
+    while (a != a_end) {
+      take_old();
+    }
+    while (b != b_end) {
+      take_staged();
+    }
+    keys_ = abc::move(keys);
+    values_ = abc::move(values);
+  }
+
+  KeyContainer keys_;
+  MappedContainer values_;
+};
+
+template <class Key, class T, class Compare, class KC, class MC>
+bool operator==(const flat_map<Key, T, Compare, KC, MC> &lhs,
+                const flat_map<Key, T, Compare, KC, MC> &rhs) {
+  return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+template <class Key, class T, class Compare, class KC, class MC>
+bool operator!=(const flat_map<Key, T, Compare, KC, MC> &lhs,
+                const flat_map<Key, T, Compare, KC, MC> &rhs) {
+  return !(lhs == rhs);
+}
+template <class Key, class T, class Compare, class KC, class MC>
+void swap(flat_map<Key, T, Compare, KC, MC> &lhs,
+          flat_map<Key, T, Compare, KC, MC> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_FLAT_MAP_H_
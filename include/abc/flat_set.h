@@ -0,0 +1,313 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_FLAT_SET_H_
+#define ABC_FLAT_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/iterator.h"
+#include "abc/utility.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// Tell a constructor or `insert()` of abc::flat_set and abc::flat_map that
+// the given keys are sorted and unique, so they are not sorted again.
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace internal {
+
+// Whether `Compare::is_transparent` names a type, which enables lookups by
+// any type that `Compare` accepts.
+template <class Compare, class K, class = void>
+struct if_transparent {};
+template <class Compare, class K>
+struct if_transparent<Compare, K,
+                      std::void_t<typename Compare::is_transparent>> {
+  using type = K;
+};
+template <class Compare, class K>
+using if_transparent_t = typename if_transparent<Compare, K>::type;
+
+}  // namespace internal
+
+// A set of unique keys sorted in one contiguous `KeyContainer`, which is
+// searched by abc::lower_bound (branchless and prefetching).  Lookups touch
+// no pointers, but inserting or erasing a key moves the keys after it, so it
+// suits tables that are built in bulk and read often.
+//
+// Inserting a range stages and sorts the new keys, then merges them with the
+// old ones in a single pass, instead of moving the old keys once per key.
+template <class Key, class Compare = std::less<Key>,
+          class KeyContainer = abc::vector<Key>>
+class flat_set : private abc::ebo_storage<Compare> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using reference = const Key &;
+  using const_reference = const Key &;
+  using size_type = typename KeyContainer::size_type;
+  using difference_type = std::ptrdiff_t;
+  using iterator = typename KeyContainer::const_iterator;
+  using const_iterator = typename KeyContainer::const_iterator;
+  using container_type = KeyContainer;
+
+ private:
+  using compare_base = abc::ebo_storage<Compare>;
+  const Compare &compare() const noexcept { return compare_base::get(); }
+  bool equivalent(const Key &a, const Key &b) const {
+    return !compare()(a, b) && !compare()(b, a);
+  }
+
+ public:
+  // construction
+  flat_set() = default;
+  explicit flat_set(const Compare &comp) : compare_base(comp) {}
+  explicit flat_set(KeyContainer keys, const Compare &comp = Compare())
+      : compare_base(comp), keys_(abc::move(keys)) {
+    sort_and_unique();
+  }
+  flat_set(sorted_unique_t, KeyContainer keys,
+           const Compare &comp = Compare())
+      : compare_base(comp), keys_(abc::move(keys)) {}
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  flat_set(InputIt first, InputIt last, const Compare &comp = Compare())
+      : compare_base(comp), keys_(first, last) {
+    sort_and_unique();
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  flat_set(sorted_unique_t, InputIt first, InputIt last,
+           const Compare &comp = Compare())
+      : compare_base(comp), keys_(first, last) {}
+  flat_set(std::initializer_list<Key> init, const Compare &comp = Compare())
+      : flat_set(init.begin(), init.end(), comp) {}
+  flat_set(sorted_unique_t, std::initializer_list<Key> init,
+           const Compare &comp = Compare())
+      : flat_set(sorted_unique, init.begin(), init.end(), comp) {}
+  flat_set &operator=(std::initializer_list<Key> init) {
+    keys_.assign(init.begin(), init.end());
+    sort_and_unique();
+    return *this;
+  }
+
+  // iterators
+  const_iterator begin() const noexcept { return keys_.begin(); }
+  const_iterator cbegin() const noexcept { return keys_.begin(); }
+  const_iterator end() const noexcept { return keys_.end(); }
+  const_iterator cend() const noexcept { return keys_.end(); }
+
+  // capacity
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type capacity() const noexcept { return keys_.capacity(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+  void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+  // observers
+  key_compare key_comp() const { return compare(); }
+  value_compare value_comp() const { return compare(); }
+  const KeyContainer &keys() const noexcept { return keys_; }
+  // Take the keys out, leaving this set empty.
+  KeyContainer extract() && {
+    auto keys = abc::move(keys_);
+    keys_.clear();
+    return keys;
+  }
+  // Replace the keys by sorted and unique `keys`.
+  void replace(KeyContainer &&keys) { keys_ = abc::move(keys); }
+
+  // lookup
+  const_iterator lower_bound(const Key &key) const {
+    return abc::lower_bound(keys_.begin(), keys_.end(), key, compare());
+  }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  const_iterator lower_bound(const K &key) const {
+    return abc::lower_bound(keys_.begin(), keys_.end(), key, compare());
+  }
+  const_iterator upper_bound(const Key &key) const {
+    return abc::upper_bound(keys_.begin(), keys_.end(), key, compare());
+  }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  const_iterator upper_bound(const K &key) const {
+    return abc::upper_bound(keys_.begin(), keys_.end(), key, compare());
+  }
+  const_iterator find(const Key &key) const { return find_key(key); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  const_iterator find(const K &key) const { return find_key(key); }
+  bool contains(const Key &key) const { return find_key(key) != end(); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  bool contains(const K &key) const { return find_key(key) != end(); }
+  size_type count(const Key &key) const { return contains(key); }
+  template <class K, class = internal::if_transparent_t<Compare, K>>
+  size_type count(const K &key) const { return contains(key); }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const {
+    auto first = lower_bound(key);
+    return {first, first + (first != end() && !compare()(key, *first))};
+  }
+
+  // modifiers
+  std::pair<iterator, bool> insert(const Key &key) { return emplace(key); }
+  std::pair<iterator, bool> insert(Key &&key) {
+    return emplace(abc::move(key));
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    if constexpr (sizeof...(Args) == 1 &&
+                  (std::is_same_v<std::decay_t<Args>, Key> && ...)) {
+      return emplace_key(std::forward<Args>(args)...);
+    } else {
+      return emplace_key(Key(std::forward<Args>(args)...));
+    }
+  }
+  // Insert the keys in [first, last) that are absent, by one merge.
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void insert(InputIt first, InputIt last) {
+    auto staged = KeyContainer(first, last);
+    std::stable_sort(staged.begin(), staged.end(), compare());
+    merge(&staged);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void insert(sorted_unique_t, InputIt first, InputIt last) {
+    auto staged = KeyContainer(first, last);
+    merge(&staged);
+  }
+  void insert(std::initializer_list<Key> init) {
+    insert(init.begin(), init.end());
+  }
+  iterator erase(const_iterator pos) { return keys_.erase(pos); }
+  iterator erase(const_iterator first, const_iterator last) {
+    return keys_.erase(first, last);
+  }
+  size_type erase(const Key &key) {
+    auto iter = find_key(key);
+    if (iter == end()) {
+      return 0;
+    }
+    keys_.erase(iter);
+    return 1;
+  }
+  // Erase the keys that satisfy `pred`, and return how many are erased.
+  template <class Predicate>
+  size_type erase_if(Predicate pred) {
+    auto first = std::remove_if(keys_.begin(), keys_.end(), pred);
+    auto count = keys_.end() - first;
+    keys_.erase(first, keys_.end());
+    return count;
+  }
+  void clear() noexcept { keys_.clear(); }
+  void swap(flat_set &other) noexcept {
+    using std::swap;
+    swap(compare_base::get(), other.compare_base::get());
+    keys_.swap(other.keys_);
+  }
+
+ private:
+  template <class K>
+  const_iterator find_key(const K &key) const {
+    auto iter = abc::lower_bound(keys_.begin(), keys_.end(), key, compare());
+    return iter != end() && !compare()(key, *iter) ? iter : end();
+  }
+  std::pair<iterator, bool> emplace_key(Key &&key) {
+    auto iter = lower_bound(key);
+    if (iter != end() && !compare()(key, *iter)) {
+      return {iter, false};
+    }
+    return {keys_.insert(iter, abc::move(key)), true};
+  }
+  std::pair<iterator, bool> emplace_key(const Key &key) {
+    auto iter = lower_bound(key);
+    if (iter != end() && !compare()(key, *iter)) {
+      return {iter, false};
+    }
+    return {keys_.insert(iter, key), true};
+  }
+  void sort_and_unique() {
+    if (!std::is_sorted(keys_.begin(), keys_.end(), compare())) {
+      std::stable_sort(keys_.begin(), keys_.end(), compare());
+    }
+    keys_.erase(std::unique(keys_.begin(), keys_.end(),
+        [this](const Key &a, const Key &b) { return equivalent(a, b); }),
+        keys_.end());
+  }
+  // Merge the sorted keys in `staged` into `keys_`, keeping the first of
+  // equivalent keys.  Keys after all the old ones are simply appended.
+  void merge(KeyContainer *staged) {
+    auto b = staged->begin(), b_end = staged->end();
+    if (keys_.empty() || (b != b_end && compare()(keys_.back(), *b))) {
+      keys_.reserve(keys_.size() + staged->size());
+      for (; b != b_end; ++b) {
+        if (keys_.empty() || compare()(keys_.back(), *b)) {
+          keys_.push_back(std::move_if_noexcept(*b));
+        }
+      }
+      return;
+    }
+    auto merged = KeyContainer();
+    merged.reserve(keys_.size() + staged->size());
+    auto a = keys_.begin(), a_end = keys_.end();
+    // `merged.back()` is the last key taken, so a staged duplicate of it is
+    // skipped:
+    auto take_staged = [&]() {
+      if (merged.empty() || compare()(merged.back(), *b)) {
+        merged.push_back(std::move_if_noexcept(*b));
+      }
+      ++b;
+    };
+    while (a != a_end && b != b_end) {
+      if (compare()(*b, *a)) {
+        take_staged();
+      } else {
+        if (!compare()(*a, *b)) {
+          ++b;  // the old key is kept
+        }
+        merged.push_back(std::move_if_noexcept(*a));
+        ++a;
+      }
+    }
+    for (; a != a_end; ++a) {
+      merged.push_back(std::move_if_noexcept(*a));
+    }
+    while (b != b_end) {
+      take_staged();
+    }
+    keys_ = abc::move(merged);
+  }
+
+  KeyContainer keys_;
+};
+
+template <class Key, class Compare, class KeyContainer>
+bool operator==(const flat_set<Key, Compare, KeyContainer> &lhs,
+                const flat_set<Key, Compare, KeyContainer> &rhs) {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class Key, class Compare, class KeyContainer>
+bool operator!=(const flat_set<Key, Compare, KeyContainer> &lhs,
+                const flat_set<Key, Compare, KeyContainer> &rhs) {
+  return !(lhs == rhs);
+}
+template <class Key, class Compare, class KeyContainer>
+void swap(flat_set<Key, Compare, KeyContainer> &lhs,
+          flat_set<Key, Compare, KeyContainer> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_FLAT_SET_H_
@@ -2,18 +2,27 @@
 #ifndef ABC_FORWARD_LIST_H_
 #define ABC_FORWARD_LIST_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
+#include "abc/algorithm.h"
 #include "abc/iterator.h"
+#include "abc/stats.h"
 #include "abc/utility.h"
 
 namespace abc {
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class forward_list {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using size_type = std::size_t;
   using reference = value_type &;
   using const_reference = const value_type &;
@@ -22,94 +31,194 @@ class forward_list {
 
  public:
   forward_list() = default;
+  explicit forward_list(const Allocator &alloc)
+      : head_(NodeAllocator(alloc)) {}
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  forward_list(InputIt first, InputIt last,
+               const Allocator &alloc = Allocator())
+      : forward_list(alloc) {
+    insert_after(before_begin(), first, last);
+  }
+  forward_list(std::initializer_list<T> init,
+               const Allocator &alloc = Allocator())
+      : forward_list(init.begin(), init.end(), alloc) {}
   ~forward_list() noexcept { clear(); }
   // copy operations:
-  forward_list(const forward_list &that) { *this = that; }
+  forward_list(const forward_list &that)
+      : head_(node_alloc_traits::select_on_container_copy_construction(
+            that.node_allocator())) {
+    copy_from(that);
+  }
   forward_list &operator=(const forward_list &that) {
     if (this != &that) {
       clear();
-      auto iter_of_that = that.begin();
-      auto iend_of_that = that.end();
-      // add the 1st item, if any:
-      if (iter_of_that != iend_of_that) {
-        emplace_front(*iter_of_that);
-        ++iter_of_that;
-      }
-      // add the other items, if any:
-      auto iter_of_this = begin();
-      while (iter_of_that != iend_of_that) {
-        iter_of_this = emplace_after(iter_of_this, *iter_of_that);
-        ++iter_of_that;
+      if constexpr (
+          node_alloc_traits::propagate_on_container_copy_assignment::value) {
+        node_allocator() = that.node_allocator();
       }
+      copy_from(that);
     }
     return *this;
   }
   // move operations:
-  forward_list(forward_list &&that) noexcept {
-    *this = abc::move(that);
+  forward_list(forward_list &&that) noexcept
+      : head_(abc::move(that.node_allocator())) {
+    std::swap(head_.ptr_next, that.head_.ptr_next);
   }
-  forward_list &operator=(forward_list &&that) noexcept {
+  forward_list &operator=(forward_list &&that) noexcept(
+      node_alloc_traits::propagate_on_container_move_assignment::value ||
+      node_alloc_traits::is_always_equal::value) {
     if (this != &that) {
       clear();
-      std::swap(this->ptr_head_, that.ptr_head_);
+      if constexpr (
+          !node_alloc_traits::propagate_on_container_move_assignment::value &&
+          !node_alloc_traits::is_always_equal::value) {
+        if (node_allocator() != that.node_allocator()) {
+          // cannot steal nodes from another allocator, so move one by one:
+          copy_from</* kMove = */true>(that);
+          that.clear();
+          return *this;
+        }
+      }
+      if constexpr (
+          node_alloc_traits::propagate_on_container_move_assignment::value) {
+        node_allocator() = abc::move(that.node_allocator());
+      }
+      std::swap(head_.ptr_next, that.head_.ptr_next);
     }
     return *this;
   }
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(node_allocator());
+  }
   // accessors:
-  bool empty() const noexcept { return !ptr_head_; }
-  reference front() { return ptr_head_->value; }
-  const_reference front() const { return ptr_head_->value; }
+  bool empty() const noexcept { return !head_.ptr_next; }
+  reference front() { return head_.ptr_next->value; }
+  const_reference front() const { return head_.ptr_next->value; }
   // mutators:
-  void clear() noexcept {
-    while (!empty()) {
-      pop_front();
+  void clear() noexcept { delete_after(before_head(), nullptr); }
+  void swap(forward_list &that) noexcept {
+    if constexpr (node_alloc_traits::propagate_on_container_swap::value) {
+      std::swap(node_allocator(), that.node_allocator());
     }
+    std::swap(head_.ptr_next, that.head_.ptr_next);
   }
 
  private:
-  struct Node {
-   public:  // type member:
-#ifdef ABC_USE_SMART_POINTER_
-    using Pointer = std::unique_ptr<Node>;
-#else
-    using Pointer = Node*;
-#endif
+  struct Node;
+  // The link part of a node, which is also the head of the list, so that
+  // `before_begin()` can be handled like any other position.
+  struct NodeBase {
+    Node *ptr_next{ nullptr };
+    NodeBase() = default;
+    explicit NodeBase(Node *ptr_node) : ptr_next(ptr_node) { }
+  };
+  struct Node : NodeBase {
    public:  // data members:
     value_type value;
-    Pointer ptr_next;
    public:  // constuctors:
-    template <class... Args>
-    explicit Node(Args&&... args) : value(abc::forward<Args>(args)...) { }
     template <class... Args>
     explicit Node(Node *ptr_node, Args&&... args)
-      : ptr_next(ptr_node), value(abc::forward<Args>(args)...) { }
+      : NodeBase(ptr_node), value(abc::forward<Args>(args)...) { }
   };
 
  private:
-  using NodePtr = typename Node::Pointer;
-  NodePtr ptr_head_{ nullptr };  // the only data member of forward_list<T>
+  using node_alloc_traits = typename std::allocator_traits<
+      Allocator>::template rebind_traits<Node>;
+  using NodeAllocator = typename node_alloc_traits::allocator_type;
+  // The head is stored together with the allocator, which takes no space if
+  // it is empty.
+  struct Head : abc::ebo_storage<NodeAllocator>, NodeBase {
+    using abc::ebo_storage<NodeAllocator>::ebo_storage;
+  };
+  Head head_;  // the only data member of forward_list<T>
+
+  NodeAllocator &node_allocator() noexcept { return head_.get(); }
+  const NodeAllocator &node_allocator() const noexcept { return head_.get(); }
+  NodeBase *before_head() noexcept { return &head_; }
+  NodeBase *before_head() const noexcept {
+    return const_cast<Head *>(&head_);
+  }
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s) noexcept { internal::count<forward_list>(s); }
+  template <class... Args>
+  Node *new_node(Node *ptr_next, Args&&... args) {
+    auto ptr_new = node_alloc_traits::allocate(node_allocator(), 1);
+    record(stat::kAllocations);
+    try {
+      node_alloc_traits::construct(node_allocator(), ptr_new, ptr_next,
+                                   abc::forward<Args>(args)...);
+    } catch (...) {
+      node_alloc_traits::deallocate(node_allocator(), ptr_new, 1);
+      record(stat::kDeallocations);
+      throw;
+    }
+    internal::count_construction<forward_list, T, Args...>();
+    return ptr_new;
+  }
+  void delete_node(Node *ptr_old) noexcept {
+    node_alloc_traits::destroy(node_allocator(), ptr_old);
+    node_alloc_traits::deallocate(node_allocator(), ptr_old, 1);
+    record(stat::kDestructions);
+    record(stat::kDeallocations);
+  }
+  // Link the nodes made from [first, last) after `ptr_prev`, and return the
+  // last one (or `ptr_prev` if none).  Nothing is linked if any throws.
+  template <class InputIt, class Make>
+  NodeBase *link_after(NodeBase *ptr_prev, InputIt first, InputIt last,
+                       Make &&make) {
+    auto chain = NodeBase();
+    NodeBase *ptr_tail = &chain;
+    try {
+      for (; first != last; ++first) {
+        ptr_tail->ptr_next = make(first);
+        ptr_tail = ptr_tail->ptr_next;
+      }
+    } catch (...) {
+      delete_after(&chain, nullptr);
+      throw;
+    }
+    if (ptr_tail != &chain) {
+      ptr_tail->ptr_next = ptr_prev->ptr_next;
+      ptr_prev->ptr_next = chain.ptr_next;
+      return ptr_tail;
+    }
+    return ptr_prev;
+  }
+  // Delete the nodes in (ptr_prev, ptr_last), and return `ptr_last`.
+  Node *delete_after(NodeBase *ptr_prev, Node *ptr_last) noexcept {
+    auto ptr_node = ptr_prev->ptr_next;
+    while (ptr_node != ptr_last) {
+      auto ptr_next = ptr_node->ptr_next;
+      delete_node(ptr_node);
+      ptr_node = ptr_next;
+    }
+    ptr_prev->ptr_next = ptr_last;
+    return ptr_last;
+  }
+  // append the items of that (moved if `kMove`) to an empty list:
+  template <bool kMove = false>
+  void copy_from(const forward_list &that) {
+    auto first = iterator(that.head_.ptr_next), last = iterator(nullptr);
+    link_after(before_head(), first, last, [this](iterator iter) {
+      if constexpr (kMove) {
+        return new_node(nullptr, abc::move(*iter));
+      } else {
+        return new_node(nullptr, *iter);
+      }
+    });
+  }
 
  public:  // operations at the beginning:
   template <class... Args>
   void emplace_front(Args&&... args) {
-#ifdef ABC_USE_SMART_POINTER_
-    auto ptr_new = std::make_unique<Node>(
-      ptr_head_.release()/* raw pointer of the old head */,
-      abc::forward<Args>(args).../* arguments for value */);
-    ptr_new.swap(ptr_head_);
-#else
-    ptr_head_ = new Node(ptr_head_, abc::forward<Args>(args)...);
-#endif
+    head_.ptr_next = new_node(head_.ptr_next, abc::forward<Args>(args)...);
   }
   void pop_front() noexcept {
-#ifdef ABC_USE_SMART_POINTER_
-    auto ptr_next = ptr_head_->ptr_next.release();
-    ptr_head_.reset(ptr_next);
-#else
-    auto ptr_old = ptr_head_;
-    ptr_head_ = ptr_head_->ptr_next;
-    delete ptr_old;
-#endif
+    auto ptr_old = head_.ptr_next;
+    head_.ptr_next = ptr_old->ptr_next;
+    delete_node(ptr_old);
   }
 
  public:  // iterators and related methods
@@ -117,10 +226,12 @@ class forward_list {
       std::forward_iterator_tag, forward_list::value_type> {
     friend forward_list;
    protected:
-    Node *ptr_node{ nullptr };
+    NodeBase *ptr_node{ nullptr };
    public:
-    explicit iterator(Node *ptr_node) noexcept : ptr_node(ptr_node) { }
-    reference operator*() const noexcept { return ptr_node->value; }
+    explicit iterator(NodeBase *ptr_node) noexcept : ptr_node(ptr_node) { }
+    reference operator*() const noexcept {
+      return static_cast<Node *>(ptr_node)->value;
+    }
     pointer operator->() const noexcept { return &this->operator*(); }
     bool operator==(iterator const &rhs) const noexcept {
       return ptr_node == rhs.ptr_node;
@@ -129,12 +240,12 @@ class forward_list {
       return !(*this == rhs);
     }
     iterator &operator++() noexcept {
-      ptr_node = &(*(ptr_node->ptr_next));
+      ptr_node = ptr_node->ptr_next;
       return *this;
     }
     iterator operator++(int) noexcept {
       auto iter = iterator(ptr_node);
-      ptr_node = &(*(ptr_node->ptr_next));
+      ptr_node = ptr_node->ptr_next;
       return iter;
     }
   };  // iterator
@@ -143,15 +254,21 @@ class forward_list {
    public:
     using reference = typename forward_list::const_reference;
     using pointer = typename forward_list::const_pointer;
-    explicit const_iterator(Node *ptr_node) noexcept : iterator(ptr_node) { }
+    explicit const_iterator(NodeBase *ptr_node) noexcept
+        : iterator(ptr_node) { }
     reference operator*() const noexcept { return this->iterator::operator*(); }
     pointer operator->() const noexcept { return this->iterator::operator->(); }
   };  // const_iterator
   // range related methods:
-  iterator begin() noexcept { return iterator(&(*ptr_head_)); }
+  iterator before_begin() noexcept { return iterator(before_head()); }
+  const_iterator before_begin() const noexcept { return cbefore_begin(); }
+  const_iterator cbefore_begin() const noexcept {
+    return const_iterator(before_head());
+  }
+  iterator begin() noexcept { return iterator(head_.ptr_next); }
   const_iterator begin() const noexcept { return cbegin(); };
   const_iterator cbegin() const noexcept {
-    return const_iterator(&(*ptr_head_));
+    return const_iterator(head_.ptr_next);
   };
   iterator end() noexcept { return iterator(nullptr); }
   const_iterator end() const noexcept { return cend(); }
@@ -159,40 +276,273 @@ class forward_list {
   // construct a new element after an element given by an iterator:
   template <class... Args>
   iterator emplace_after(iterator iter, Args&&... args) {
-#ifdef ABC_USE_SMART_POINTER_
     auto &ptr_next = iter.ptr_node->ptr_next;
-    auto ptr_new = std::make_unique<Node>(
-      ptr_next.release()/* raw pointer of the old head */,
-      abc::forward<Args>(args).../* arguments for value */);
-    ptr_next.reset(ptr_new.release());
-#else
-    auto &ptr_next = iter.ptr_node->ptr_next;
-    auto ptr_new = new Node(ptr_next, abc::forward<Args>(args)...);  // NOLINT
-    ptr_next = ptr_new;
-#endif
+    ptr_next = new_node(ptr_next, abc::forward<Args>(args)...);
     return ++iter;
   }
+  // Insert copies of [first, last) after `iter`, and return the last one.
+  // All nodes are made before any is linked, so a throw changes nothing.
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  iterator insert_after(iterator iter, InputIt first, InputIt last) {
+    return iterator(link_after(iter.ptr_node, first, last,
+        [this](InputIt it) { return new_node(nullptr, *it); }));
+  }
+  iterator insert_after(iterator iter, size_type count, const T &value) {
+    auto make = [this, &value](size_type) { return new_node(nullptr, value); };
+    return iterator(link_after(iter.ptr_node, size_type(0), count, make));
+  }
+  iterator insert_after(iterator iter, std::initializer_list<T> init) {
+    return insert_after(iter, init.begin(), init.end());
+  }
+  // Erase the element after `iter`, and return the one after the erased.
+  iterator erase_after(iterator iter) noexcept {
+    auto ptr_prev = iter.ptr_node;
+    return iterator(delete_after(ptr_prev, ptr_prev->ptr_next->ptr_next));
+  }
+  // Erase the elements in (first, last), and return `last`.
+  iterator erase_after(iterator first, iterator last) noexcept {
+    return iterator(delete_after(first.ptr_node,
+                                 static_cast<Node *>(last.ptr_node)));
+  }
+  // Move the elements in (first, last) of `that` after `iter`, by relinking
+  // nodes.  Only (first, last) is walked to find its end, so moving a single
+  // element (i.e. `last == ++first`) takes O(1).  The allocators must equal.
+  void splice_after(iterator iter, forward_list &that,  // NOLINT
+                    iterator first, iterator last) noexcept {
+    assert(node_allocator() == that.node_allocator());
+    auto ptr_first = first.ptr_node, ptr_last = last.ptr_node;
+    if (ptr_first == ptr_last || ptr_first->ptr_next == ptr_last) {
+      return;
+    }
+    NodeBase *ptr_tail = ptr_first->ptr_next;
+    while (ptr_tail->ptr_next != ptr_last) {
+      ptr_tail = ptr_tail->ptr_next;
+    }
+    auto ptr_prev = iter.ptr_node;
+    ptr_tail->ptr_next = ptr_prev->ptr_next;
+    ptr_prev->ptr_next = ptr_first->ptr_next;
+    ptr_first->ptr_next = static_cast<Node *>(ptr_last);
+  }
+  void splice_after(iterator iter, forward_list &&that,
+                    iterator first, iterator last) noexcept {
+    splice_after(iter, that, first, last);
+  }
+  // Move the element after `it` of `that` after `iter` in O(1).
+  void splice_after(iterator iter, forward_list &that,  // NOLINT
+                    iterator it) noexcept {
+    auto next = it;
+    ++next;
+    if (iter != it && iter != next && next != that.end()) {
+      splice_after(iter, that, it, ++next);
+    }
+  }
+  void splice_after(iterator iter, forward_list &&that, iterator it) noexcept {
+    splice_after(iter, that, it);
+  }
+  // Move all elements of `that` after `iter`.
+  void splice_after(iterator iter, forward_list &that) noexcept {  // NOLINT
+    splice_after(iter, that, that.before_begin(), that.end());
+  }
+  void splice_after(iterator iter, forward_list &&that) noexcept {
+    splice_after(iter, that);
+  }
+
+ private:  // helpers of the list operations, which only relink nodes
+  static NodeBase *last_of(NodeBase *ptr_node) noexcept {
+    while (ptr_node->ptr_next) {
+      ptr_node = ptr_node->ptr_next;
+    }
+    return ptr_node;
+  }
+  // Link the sorted chains `ptr_a` and `ptr_b` after `ptr_head` in sorted
+  // order, taking from `ptr_a` first on ties.  If `comp` throws, all nodes
+  // are still linked after `ptr_head`, in an unspecified order.
+  template <class Compare>
+  static void merge_after(NodeBase *ptr_head, Node *ptr_a, Node *ptr_b,
+                          Compare &comp) {
+    auto ptr_tail = ptr_head;
+    try {
+      while (ptr_a && ptr_b) {
+        if (comp(ptr_b->value, ptr_a->value)) {
+          ptr_tail->ptr_next = ptr_b;
+          ptr_b = ptr_b->ptr_next;
+        } else {
+          ptr_tail->ptr_next = ptr_a;
+          ptr_a = ptr_a->ptr_next;
+        }
+        ptr_tail = ptr_tail->ptr_next;
+      }
+    } catch (...) {
+      ptr_tail->ptr_next = ptr_a;
+      last_of(ptr_tail)->ptr_next = ptr_b;
+      throw;
+    }
+    ptr_tail->ptr_next = ptr_a ? ptr_a : ptr_b;
+  }
+  // Unlink the nodes after `ptr_prev` for which `unwanted(ptr_prev, ptr_node)`
+  // holds, and delete them once all have been visited, since `unwanted` may
+  // refer to a value in one of them.  Return the number deleted.
+  template <class Unwanted>
+  size_type delete_if(NodeBase *ptr_prev, Unwanted &&unwanted) {
+    auto garbage = NodeBase();
+    NodeBase *ptr_tail = &garbage;
+    size_type count = 0;
+    try {
+      while (auto ptr_node = ptr_prev->ptr_next) {
+        if (unwanted(ptr_prev, ptr_node)) {
+          ptr_prev->ptr_next = ptr_node->ptr_next;
+          ptr_tail = ptr_tail->ptr_next = ptr_node;
+          ++count;
+        } else {
+          ptr_prev = ptr_node;
+        }
+      }
+    } catch (...) {
+      ptr_tail->ptr_next = nullptr;
+      delete_after(&garbage, nullptr);
+      throw;
+    }
+    ptr_tail->ptr_next = nullptr;
+    delete_after(&garbage, nullptr);
+    return count;
+  }
+
+ public:  // list operations, which never allocate, copy or move a value
+  // Merge the sorted `that` into this sorted list, keeping the elements of
+  // this before the equal ones of `that`.  The allocators must equal.
+  template <class Compare>
+  void merge(forward_list &that, Compare comp) {  // NOLINT
+    assert(node_allocator() == that.node_allocator());
+    if (this != &that) {
+      auto ptr_that = that.head_.ptr_next;
+      that.head_.ptr_next = nullptr;
+      merge_after(before_head(), head_.ptr_next, ptr_that, comp);
+    }
+  }
+  template <class Compare>
+  void merge(forward_list &&that, Compare comp) {
+    merge(that, comp);
+  }
+  void merge(forward_list &that) { merge(that, std::less<>()); }  // NOLINT
+  void merge(forward_list &&that) { merge(that, std::less<>()); }
+  // Sort the elements stably by a bottom-up merge sort in O(N log N).  The
+  // `k`-th bin holds either nothing or a sorted run of `2^k` nodes, which
+  // is older than the runs in the lower bins.  If `comp` throws, the
+  // elements are kept in an unspecified order.
+  template <class Compare>
+  void sort(Compare comp) {
+    constexpr int kBins = 64;
+    Node *bins[kBins] = {};
+    int num_bins = 0;
+    auto carry = NodeBase();
+    auto ptr_node = head_.ptr_next;
+    head_.ptr_next = nullptr;
+    try {
+      while (ptr_node) {
+        carry.ptr_next = ptr_node;
+        ptr_node = ptr_node->ptr_next;
+        carry.ptr_next->ptr_next = nullptr;
+        int k = 0;
+        for (; k != num_bins && bins[k]; ++k) {
+          auto ptr_run = bins[k];
+          bins[k] = nullptr;
+          merge_after(&carry, ptr_run, carry.ptr_next, comp);
+        }
+        bins[k] = carry.ptr_next;
+        carry.ptr_next = nullptr;
+        num_bins = std::max(num_bins, k + 1);
+      }
+      for (int k = 0; k != num_bins; ++k) {
+        if (auto ptr_run = bins[k]) {
+          bins[k] = nullptr;
+          merge_after(&carry, ptr_run, carry.ptr_next, comp);
+        }
+      }
+    } catch (...) {
+      // Put every node back:
+      auto ptr_tail = last_of(&carry);
+      for (int k = 0; k != num_bins; ++k) {
+        if (bins[k]) {
+          ptr_tail->ptr_next = bins[k];
+          ptr_tail = last_of(ptr_tail);
+        }
+      }
+      ptr_tail->ptr_next = ptr_node;
+      head_.ptr_next = carry.ptr_next;
+      throw;
+    }
+    head_.ptr_next = carry.ptr_next;
+  }
+  void sort() { sort(std::less<>()); }
+  void reverse() noexcept {
+    Node *ptr_reversed = nullptr;
+    auto ptr_node = head_.ptr_next;
+    while (ptr_node) {
+      auto ptr_next = ptr_node->ptr_next;
+      ptr_node->ptr_next = ptr_reversed;
+      ptr_reversed = ptr_node;
+      ptr_node = ptr_next;
+    }
+    head_.ptr_next = ptr_reversed;
+  }
+  // Erase all elements satisfying `pred`, and return the number erased.
+  template <class UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred) {
+    return delete_if(before_head(), [&pred](NodeBase *, Node *ptr_node) {
+      return pred(ptr_node->value);
+    });
+  }
+  size_type remove(const T &value) {
+    return remove_if([&value](const T &x) { return x == value; });
+  }
+  // Erase all but the first of each group of consecutive equal elements,
+  // and return the number erased.
+  template <class BinaryPredicate>
+  size_type unique(BinaryPredicate pred) {
+    if (empty()) {
+      return 0;
+    }
+    // Only the first node of a group stays, so it is always `ptr_prev`:
+    return delete_if(head_.ptr_next, [&pred](NodeBase *ptr_prev,
+                                             Node *ptr_node) {
+      return pred(static_cast<Node *>(ptr_prev)->value, ptr_node->value);
+    });
+  }
+  size_type unique() { return unique(std::equal_to<>()); }
 };  // forward_list
 
-template <class T>
-bool operator==(const forward_list<T> &lhs,
-                const forward_list<T> &rhs) noexcept {
-  auto iter = lhs.begin();
-  const auto iend = lhs.end();
-  for (const auto &x : rhs) {
-    if (iter == iend || *iter != x) {
-      return false;
-    } else {
-      ++iter;
-    }
-  }
-  return iter == iend;
+template <class T, class Allocator>
+bool operator==(const forward_list<T, Allocator> &lhs,
+                const forward_list<T, Allocator> &rhs) noexcept {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
-template <class T>
-bool operator!=(const forward_list<T> &lhs,
-                const forward_list<T> &rhs) noexcept {
+template <class T, class Allocator>
+bool operator!=(const forward_list<T, Allocator> &lhs,
+                const forward_list<T, Allocator> &rhs) noexcept {
   return !(lhs == rhs);
 }
+template <class T, class Allocator>
+bool operator<(const forward_list<T, Allocator> &lhs,
+               const forward_list<T, Allocator> &rhs) {
+  return abc::lexicographical_compare(lhs.begin(), lhs.end(),
+                                      rhs.begin(), rhs.end());
+}
+template <class T, class Allocator>
+bool operator>(const forward_list<T, Allocator> &lhs,
+               const forward_list<T, Allocator> &rhs) {
+  return rhs < lhs;
+}
+template <class T, class Allocator>
+bool operator<=(const forward_list<T, Allocator> &lhs,
+                const forward_list<T, Allocator> &rhs) {
+  return !(rhs < lhs);
+}
+template <class T, class Allocator>
+bool operator>=(const forward_list<T, Allocator> &lhs,
+                const forward_list<T, Allocator> &rhs) {
+  return !(lhs < rhs);
+}
 
 }  // namespace abc
 
@@ -0,0 +1,767 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_HASH_TABLE_H_
+#define ABC_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "abc/iterator.h"
+#include "abc/simd.h"
+#include "abc/stats.h"
+#include "abc/utility.h"
+
+namespace abc {
+namespace internal {
+
+// Spread the bits of a hash value, e.g. `std::hash<int>`, which returns the
+// integer itself, so that both its low and high bits look random.
+inline std::size_t mix_hash(std::size_t h) noexcept {
+  auto product = static_cast<unsigned __int128>(h) * 0x9E3779B97F4A7C15u;
+  return static_cast<std::size_t>(product) ^
+         static_cast<std::size_t>(product >> 64);
+}
+
+// Whether `T::is_transparent` names a type, e.g. in `std::equal_to<>`.
+template <class T, class = void>
+struct is_transparent : std::false_type {};
+template <class T>
+struct is_transparent<T, std::void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+// `key_arg<true>::type<K, Key>` is `K` itself, so that `K` can be deduced
+// from the argument of a lookup, while `key_arg<false>::type<K, Key>` is
+// always `Key`, so that the argument is converted to `Key` first.
+template <bool kTransparent>
+struct key_arg {
+  template <class K, class Key>
+  using type = Key;
+};
+template <>
+struct key_arg<true> {
+  template <class K, class Key>
+  using type = K;
+};
+
+// An open-addressing hash table in the style of Swiss tables, which holds
+// the elements of abc::flat_hash_map and abc::flat_hash_set.
+//
+// A table of `capacity()` (a power of 2) slots has a control byte per slot,
+// which is either `kEmpty` or the low 7 bits (H2) of the hash of the element
+// in that slot.  An element is stored at the first empty slot at or after
+// the slot given by the other bits (H1) of its hash, so a lookup compares
+// the H2 of the key with 16 control bytes at once (see "abc/simd.h") and
+// stops at a group having an empty slot.  The first 15 control bytes are
+// cloned after the last one, so that a group may start at any slot.
+//
+// Erasing an element shifts the rest of its cluster back by the rule of
+// linear probing, instead of leaving a tombstone, so lookups never slow
+// down from churn.  A shifted element may wrap around from the front of the
+// table, which is why an iterator after `erase()` may meet an element twice.
+//
+// The slots and the control bytes share one block from `Allocator`.
+template <class Policy, class Hash, class KeyEqual, class Allocator>
+class hash_table : private abc::ebo_storage<Hash, 0>,
+                   private abc::ebo_storage<KeyEqual, 1>,
+                   private abc::ebo_storage<Allocator, 2> {
+  static_assert(std::is_nothrow_move_constructible_v<
+                    typename Policy::mutable_value_type>,
+                "Growing and erasing must not be left halfway by a throw.");
+
+ public:
+  using key_type = typename Policy::key_type;
+  using value_type = typename Policy::value_type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+ private:
+  using slot_type = typename Policy::slot_type;
+  using ctrl_t = std::int8_t;
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using slot_alloc = typename alloc_traits::template rebind_alloc<slot_type>;
+  using slot_traits = std::allocator_traits<slot_alloc>;
+  using hash_base = abc::ebo_storage<Hash, 0>;
+  using equal_base = abc::ebo_storage<KeyEqual, 1>;
+  using allocator_base = abc::ebo_storage<Allocator, 2>;
+  Allocator &allocator() noexcept { return allocator_base::get(); }
+  const Allocator &allocator() const noexcept {
+    return allocator_base::get();
+  }
+
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr size_type kGroup = simd::kGroupBytes;
+  static constexpr size_type kMinCapacity = kGroup;
+  // Heterogeneous lookup is enabled by a transparent `Hash` and `KeyEqual`.
+  template <class K>
+  using key_arg = typename internal::key_arg<
+      is_transparent<Hash>::value && is_transparent<KeyEqual>::value>::
+      template type<K, key_type>;
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<hash_table>(s, n);
+  }
+
+ public:
+  template <bool kConst>
+  class basic_iterator {
+    friend class hash_table;
+    template <bool> friend class basic_iterator;
+    const ctrl_t *ctrl_{nullptr};
+    const ctrl_t *end_{nullptr};
+    slot_type *slot_{nullptr};
+
+    basic_iterator(const ctrl_t *ctrl, const ctrl_t *end,
+                   slot_type *slot) noexcept
+        : ctrl_(ctrl), end_(end), slot_(slot) {
+      skip_empty_slots();
+    }
+    // Move to the first full slot at or after the current one, a group of
+    // control bytes at a time.
+    void skip_empty_slots() noexcept {
+      while (ctrl_ != end_ && *ctrl_ < 0) {
+        auto full = ~simd::match_sign(ctrl_) & 0xFFFFu;
+        auto skip = static_cast<std::ptrdiff_t>(
+            full ? __builtin_ctz(full) : kGroup);
+        skip = std::min(skip, end_ - ctrl_);
+        ctrl_ += skip;
+        slot_ += skip;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename hash_table::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<kConst, const value_type &, value_type &>;
+    using pointer = std::conditional_t<kConst, const value_type *,
+                                       value_type *>;
+
+    basic_iterator() noexcept = default;
+    template <bool kOtherConst,
+              class = std::enable_if_t<kConst && !kOtherConst>>
+    basic_iterator(const basic_iterator<kOtherConst> &that) noexcept  // NOLINT
+        : ctrl_(that.ctrl_), end_(that.end_), slot_(that.slot_) {}
+
+    reference operator*() const noexcept { return Policy::element(slot_); }
+    pointer operator->() const noexcept { return &operator*(); }
+    basic_iterator &operator++() noexcept {
+      ++ctrl_;
+      ++slot_;
+      skip_empty_slots();
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      auto old = *this;
+      operator++();
+      return old;
+    }
+    friend bool operator==(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.ctrl_ == rhs.ctrl_;
+    }
+    friend bool operator!=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.ctrl_ != rhs.ctrl_;
+    }
+  };
+  // The elements of a set are keys, which must not be modified in place.
+  using iterator = basic_iterator<Policy::kConstElements>;
+  using const_iterator = basic_iterator<true>;
+
+ private:
+  // A heterogeneous key that is an iterator means an erase by position.
+  template <class K>
+  using if_not_iterator =
+      std::enable_if_t<!std::is_convertible_v<const K &, const_iterator>>;
+
+ public:
+  // construction
+  hash_table() = default;
+  explicit hash_table(size_type bucket_count, const Hash &hash = Hash(),
+                      const KeyEqual &equal = KeyEqual(),
+                      const Allocator &alloc = Allocator())
+      : hash_base(hash), equal_base(equal), allocator_base(alloc) {
+    reserve(bucket_count);
+  }
+  explicit hash_table(const Allocator &alloc) : allocator_base(alloc) {}
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  hash_table(InputIt first, InputIt last, size_type bucket_count = 0,
+             const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual(),
+             const Allocator &alloc = Allocator())
+      : hash_table(bucket_count, hash, equal, alloc) {
+    insert(first, last);
+  }
+  hash_table(std::initializer_list<value_type> init,
+             size_type bucket_count = 0, const Hash &hash = Hash(),
+             const KeyEqual &equal = KeyEqual(),
+             const Allocator &alloc = Allocator())
+      : hash_table(init.begin(), init.end(), bucket_count, hash, equal,
+                   alloc) {}
+  hash_table &operator=(std::initializer_list<value_type> init) {
+    clear();
+    insert(init);
+    return *this;
+  }
+  // destruction
+  ~hash_table() noexcept {
+    clear();
+    deallocate(slots_, capacity_);
+  }
+  // copy operations:
+  hash_table(const hash_table &that)
+      : hash_base(that.hash_function()), equal_base(that.key_eq()),
+        allocator_base(alloc_traits::select_on_container_copy_construction(
+            that.allocator())) {
+    try {
+      copy_elements(that);
+    } catch (...) {
+      clear();
+      deallocate(slots_, capacity_);
+      throw;
+    }
+  }
+  hash_table &operator=(const hash_table &that) {
+    if (this != &that) {
+      clear();
+      if constexpr (
+          alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (allocator() != that.allocator()) {
+          // return the memory to the allocator that has allocated it:
+          release();
+          allocator() = that.allocator();
+        }
+      }
+      hash_base::get() = that.hash_function();
+      equal_base::get() = that.key_eq();
+      copy_elements(that);
+    }
+    return *this;
+  }
+  // move operations:
+  hash_table(hash_table &&that) noexcept
+      : hash_base(abc::move(that.hash_base::get())),
+        equal_base(abc::move(that.equal_base::get())),
+        allocator_base(abc::move(that.allocator())) {
+    steal(&that);
+  }
+  hash_table &operator=(hash_table &&that) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &that) {
+      hash_base::get() = abc::move(that.hash_base::get());
+      equal_base::get() = abc::move(that.equal_base::get());
+      if constexpr (
+          !alloc_traits::propagate_on_container_move_assignment::value &&
+          !alloc_traits::is_always_equal::value) {
+        if (allocator() != that.allocator()) {
+          // cannot steal memory from another allocator, so move one by one:
+          clear();
+          reserve(that.size());
+          for (auto &value : that) {
+            insert_unique(Policy::key(value), abc::move(value));
+          }
+          that.clear();
+          return *this;
+        }
+      }
+      clear();
+      release();
+      if constexpr (
+          alloc_traits::propagate_on_container_move_assignment::value) {
+        allocator() = abc::move(that.allocator());
+      }
+      steal(&that);
+    }
+    return *this;
+  }
+  allocator_type get_allocator() const noexcept { return allocator(); }
+  hasher hash_function() const { return hash_base::get(); }
+  key_equal key_eq() const { return equal_base::get(); }
+
+  // iterators
+  iterator begin() noexcept { return iterator_at(0); }
+  const_iterator begin() const noexcept { return iterator_at(0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator_at(capacity_); }
+  const_iterator end() const noexcept { return iterator_at(capacity_); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.f;
+  }
+  float max_load_factor() const noexcept { return 0.875f; }
+  static constexpr size_type max_size() noexcept {
+    return growth_limit(max_capacity());
+  }
+  // Make room for `count` elements without growing.
+  void reserve(size_type count) {
+    if (count > growth_limit(capacity_)) {
+      resize(capacity_for(count));
+    }
+  }
+  // Resize to the least capacity holding `size()` and `count` elements, so
+  // `rehash(0)` shrinks the table to fit.
+  void rehash(size_type count) {
+    auto new_capacity = size_ || count
+        ? capacity_for(std::max(size_, count)) : 0;
+    if (new_capacity != capacity_) {
+      resize(new_capacity);
+    }
+  }
+
+  // lookup
+  template <class K = key_type>
+  iterator find(const key_arg<K> &key) {
+    return iterator_at(find_index(key, hash_of(key)));
+  }
+  template <class K = key_type>
+  const_iterator find(const key_arg<K> &key) const {
+    return iterator_at(find_index(key, hash_of(key)));
+  }
+  template <class K = key_type>
+  bool contains(const key_arg<K> &key) const {
+    return find_index(key, hash_of(key)) != capacity_;
+  }
+  template <class K = key_type>
+  size_type count(const key_arg<K> &key) const {
+    return contains<K>(key);
+  }
+
+  // modifiers
+  void clear() noexcept {
+    if (size_) {
+      for (size_type i = 0; i != capacity_; ++i) {
+        if (ctrl_[i] >= 0) {
+          destroy(i);
+        }
+      }
+      std::memset(ctrl_, kEmpty, capacity_ + kGroup - 1);
+      size_ = 0;
+    }
+  }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return emplace_key(Policy::key(value), value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return emplace_key(Policy::key(value), abc::move(value));
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void insert(InputIt first, InputIt last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+        typename std::iterator_traits<InputIt>::iterator_category>) {
+      reserve(size_ + std::distance(first, last));
+    }
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+  void insert(std::initializer_list<value_type> init) {
+    insert(init.begin(), init.end());
+  }
+  // Construct a `value_type` from `args`, and keep it if its key is absent.
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<
+        std::decay_t<Args>, value_type> && ...)) {
+      return insert(std::forward<Args>(args)...);
+    } else {
+      auto value = value_type(std::forward<Args>(args)...);
+      return emplace_key(Policy::key(value), abc::move(value));
+    }
+  }
+  // Erase the element at `pos`, and return the iterator to the next element
+  // not yet met, unless it has been shifted from the front of the table.
+  iterator erase(const_iterator pos) noexcept {
+    auto i = static_cast<size_type>(pos.slot_ - slots_);
+    erase_at(i);
+    return iterator_at(i);
+  }
+  template <class K = key_type, class = if_not_iterator<K>>
+  size_type erase(const key_arg<K> &key) {
+    auto i = find_index(key, hash_of(key));
+    if (i == capacity_) {
+      return 0;
+    }
+    erase_at(i);
+    return 1;
+  }
+  // Erase the elements that satisfy `pred`, and return how many are erased.
+  template <class Predicate>
+  size_type erase_if(Predicate pred) {
+    auto old_size = size_;
+    for (size_type i = 0; i != capacity_; ) {
+      // an element shifted into slot `i` has to be tested in turn:
+      if (ctrl_[i] >= 0 && pred(static_cast<const value_type &>(
+              Policy::element(slots_ + i)))) {
+        erase_at(i);
+      } else {
+        ++i;
+      }
+    }
+    return old_size - size_;
+  }
+  void swap(hash_table &other) noexcept {
+    using std::swap;
+    swap(hash_base::get(), other.hash_base::get());
+    swap(equal_base::get(), other.equal_base::get());
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      swap(allocator(), other.allocator());
+    }
+    swap(slots_, other.slots_);
+    swap(ctrl_, other.ctrl_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+  }
+
+  // map operations, which are only instantiated for abc::flat_hash_map
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return emplace_key(key, std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return emplace_key(key, std::piecewise_construct,
+        std::forward_as_tuple(abc::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = try_emplace(abc::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class P = Policy>
+  typename P::mapped_type &operator[](const key_type &key) {
+    return try_emplace(key).first->second;
+  }
+  template <class P = Policy>
+  typename P::mapped_type &operator[](key_type &&key) {
+    return try_emplace(abc::move(key)).first->second;
+  }
+  template <class K = key_type, class P = Policy>
+  typename P::mapped_type &at(const key_arg<K> &key) {
+    auto i = find_index(key, hash_of(key));
+    if (i == capacity_) {
+      throw std::out_of_range("The given key is absent!");
+    }
+    return Policy::element(slots_ + i).second;
+  }
+  template <class K = key_type, class P = Policy>
+  const typename P::mapped_type &at(const key_arg<K> &key) const {
+    return const_cast<hash_table *>(this)->template at<K>(key);
+  }
+
+ private:
+  size_type mask() const noexcept { return capacity_ - 1; }
+  static constexpr size_type growth_limit(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+  // The largest power of two whose block of slots and control bytes can be
+  // counted in bytes by a `size_type`.
+  static constexpr size_type max_capacity() noexcept {
+    constexpr auto kMax = std::numeric_limits<size_type>::max();
+    auto capacity = kMax / 2 + 1;
+    while (capacity > (kMax - kGroup - sizeof(slot_type)) /
+                          (sizeof(slot_type) + 1)) {
+      capacity /= 2;
+    }
+    return capacity;
+  }
+  static size_type capacity_for(size_type count) {
+    // Doubling beyond `max_capacity()` would wrap around to 0:
+    if (count > max_size()) {
+      throw std::length_error("The given count is too large!");
+    }
+    auto capacity = kMinCapacity;
+    while (growth_limit(capacity) < count) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+  template <class K>
+  size_type hash_of(const K &key) const {
+    return internal::mix_hash(hash_base::get()(key));
+  }
+  static size_type h1(size_type hash) noexcept { return hash >> 7; }
+  static ctrl_t h2(size_type hash) noexcept {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+  void set_ctrl(size_type i, ctrl_t c) noexcept {
+    ctrl_[i] = c;
+    if (i < kGroup - 1) {
+      ctrl_[capacity_ + i] = c;
+    }
+  }
+  iterator iterator_at(size_type i) noexcept {
+    return iterator(ctrl_ + i, ctrl_ + capacity_, slots_ + i);
+  }
+  const_iterator iterator_at(size_type i) const noexcept {
+    return const_iterator(ctrl_ + i, ctrl_ + capacity_, slots_ + i);
+  }
+  // Return the index of the element equal to `key`, or `capacity_` if none.
+  template <class K>
+  size_type find_index(const K &key, size_type hash) const {
+    if (capacity_ == 0) {
+      return 0;
+    }
+    auto pos = h1(hash) & mask();
+    while (true) {
+      auto group = ctrl_ + pos;
+      for (auto m = simd::match_byte(group, h2(hash)); m; m &= m - 1) {
+        auto i = (pos + __builtin_ctz(m)) & mask();
+        if (equal_base::get()(key, Policy::key(Policy::element(slots_ + i)))) {
+          return i;
+        }
+      }
+      if (simd::match_sign(group)) {
+        return capacity_;
+      }
+      pos = (pos + kGroup) & mask();
+    }
+  }
+  // Return the index of the first empty slot from the home slot of `hash`.
+  size_type find_empty(size_type hash) const noexcept {
+    auto pos = h1(hash) & mask();
+    while (true) {
+      if (auto m = simd::match_sign(ctrl_ + pos)) {
+        return (pos + __builtin_ctz(m)) & mask();
+      }
+      pos = (pos + kGroup) & mask();
+    }
+  }
+  // Construct an element from `args` if `key` is absent.  A full table
+  // grows after constructing the new element in the new block, since `args`
+  // might refer to an old one.
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace_key(const K &key, Args &&...args) {
+    auto hash = hash_of(key);
+    auto i = find_index(key, hash);
+    if (i != capacity_) {
+      return {iterator_at(i), false};
+    }
+    if (size_ < growth_limit(capacity_)) {
+      i = find_empty(hash);
+      construct(i, std::forward<Args>(args)...);
+      set_ctrl(i, h2(hash));
+    } else {
+      i = emplace_slow(hash, std::forward<Args>(args)...);
+    }
+    ++size_;
+    return {iterator_at(i), true};
+  }
+  template <class... Args>
+  size_type emplace_slow(size_type hash, Args &&...args) {
+    auto old_slots = slots_;
+    auto old_ctrl = ctrl_;
+    auto old_capacity = capacity_;
+    allocate(capacity_ ? capacity_ * 2 : kMinCapacity);
+    auto i = find_empty(hash);
+    try {
+      construct(i, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(slots_, capacity_);
+      slots_ = old_slots;
+      ctrl_ = old_ctrl;
+      capacity_ = old_capacity;
+      throw;
+    }
+    set_ctrl(i, h2(hash));
+    transfer_all(old_slots, old_ctrl, old_capacity);
+    deallocate(old_slots, old_capacity);
+    return i;
+  }
+  // Construct an element whose key is known to be absent.
+  template <class... Args>
+  void insert_unique(const key_type &key, Args &&...args) {
+    auto hash = hash_of(key);
+    auto i = find_empty(hash);
+    construct(i, std::forward<Args>(args)...);
+    set_ctrl(i, h2(hash));
+    ++size_;
+  }
+  // Copy the elements of `that` into this empty table.
+  void copy_elements(const hash_table &that) {
+    reserve(that.size());
+    for (auto &value : that) {
+      insert_unique(Policy::key(value), value);
+    }
+  }
+  // Remove the element at `i`, and shift back each element after it in the
+  // same cluster whose home slot is not between the hole and itself.
+  void erase_at(size_type i) noexcept {
+    destroy(i);
+    auto hole = i;
+    for (auto j = (i + 1) & mask(); ctrl_[j] != kEmpty; j = (j + 1) & mask()) {
+      auto home = h1(hash_of(Policy::key(Policy::element(slots_ + j))));
+      if (((j - home) & mask()) >= ((j - hole) & mask())) {
+        transfer(slots_ + hole, slots_ + j);
+        set_ctrl(hole, ctrl_[j]);
+        hole = j;
+      }
+    }
+    set_ctrl(hole, kEmpty);
+    --size_;
+  }
+  template <class... Args>
+  void construct(size_type i, Args &&...args) {
+    Policy::construct(allocator(), slots_ + i, std::forward<Args>(args)...);
+    internal::count_construction<hash_table, value_type, Args...>();
+  }
+  void destroy(size_type i) noexcept {
+    record(stat::kDestructions);
+    Policy::destroy(allocator(), slots_ + i);
+  }
+  void transfer(slot_type *to, slot_type *from) noexcept {
+    record(stat::kMoves);
+    record(stat::kDestructions);
+    record(stat::kBytesRelocated, sizeof(slot_type));
+    Policy::transfer(allocator(), to, from);
+  }
+  // Move the elements of an old block into the current one.
+  void transfer_all(slot_type *old_slots, const ctrl_t *old_ctrl,
+                    size_type old_capacity) noexcept {
+    for (size_type i = 0; i != old_capacity; ++i) {
+      if (old_ctrl[i] >= 0) {
+        auto hash = hash_of(Policy::key(Policy::element(old_slots + i)));
+        auto j = find_empty(hash);
+        transfer(slots_ + j, old_slots + i);
+        set_ctrl(j, h2(hash));
+      }
+    }
+    record(stat::kReallocations);
+  }
+  void resize(size_type new_capacity) {
+    auto old_slots = slots_;
+    auto old_ctrl = ctrl_;
+    auto old_capacity = capacity_;
+    if (new_capacity) {
+      allocate(new_capacity);
+      transfer_all(old_slots, old_ctrl, old_capacity);
+    } else {
+      slots_ = nullptr;
+      ctrl_ = nullptr;
+      capacity_ = 0;
+    }
+    deallocate(old_slots, old_capacity);
+  }
+  // The control bytes follow the slots in the same block.
+  static size_type block_size(size_type capacity) noexcept {
+    auto ctrl_bytes = capacity + kGroup - 1;
+    return capacity + (ctrl_bytes + sizeof(slot_type) - 1) / sizeof(slot_type);
+  }
+  // Replace the block by an empty one of `capacity` slots.
+  void allocate(size_type capacity) {
+    auto alloc = slot_alloc(allocator());
+    slots_ = slot_traits::allocate(alloc, block_size(capacity));
+    record(stat::kAllocations);
+    ctrl_ = reinterpret_cast<ctrl_t *>(slots_ + capacity);
+    capacity_ = capacity;
+    std::memset(ctrl_, kEmpty, capacity + kGroup - 1);
+  }
+  void deallocate(slot_type *slots, size_type capacity) noexcept {
+    if (slots) {
+      record(stat::kDeallocations);
+      auto alloc = slot_alloc(allocator());
+      slot_traits::deallocate(alloc, slots, block_size(capacity));
+    }
+  }
+  // Free the block of this empty table.
+  void release() noexcept {
+    deallocate(slots_, capacity_);
+    slots_ = nullptr;
+    ctrl_ = nullptr;
+    capacity_ = 0;
+  }
+  // Take the elements of `that`, which is left empty without a block.
+  void steal(hash_table *that) noexcept {
+    slots_ = that->slots_;
+    ctrl_ = that->ctrl_;
+    capacity_ = that->capacity_;
+    size_ = that->size_;
+    that->slots_ = nullptr;
+    that->ctrl_ = nullptr;
+    that->capacity_ = 0;
+    that->size_ = 0;
+  }
+
+  slot_type *slots_{nullptr};
+  ctrl_t *ctrl_{nullptr};
+  size_type capacity_{0};
+  size_type size_{0};
+};
+
+// Tables of different sizes are unequal at once, otherwise each element of
+// one is looked up in the other.
+template <class P, class H, class E, class A>
+bool operator==(const hash_table<P, H, E, A> &lhs,
+                const hash_table<P, H, E, A> &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (auto &value : lhs) {
+    auto iter = rhs.find(P::key(value));
+    if (iter == rhs.end() || !(*iter == value)) {
+      return false;
+    }
+  }
+  return true;
+}
+template <class P, class H, class E, class A>
+bool operator!=(const hash_table<P, H, E, A> &lhs,
+                const hash_table<P, H, E, A> &rhs) {
+  return !(lhs == rhs);
+}
+template <class P, class H, class E, class A>
+void swap(hash_table<P, H, E, A> &lhs,
+          hash_table<P, H, E, A> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace internal
+
+// Erase the elements of a flat hash container that satisfy `pred`.
+template <class P, class H, class E, class A, class Predicate>
+std::size_t erase_if(internal::hash_table<P, H, E, A> &table,
+                     Predicate pred) {
+  return table.erase_if(pred);
+}
+
+}  // namespace abc
+
+#endif  // ABC_HASH_TABLE_H_
@@ -0,0 +1,93 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_HAZARD_POINTER_H_
+#define ABC_HAZARD_POINTER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace abc {
+namespace internal {
+
+// The hazard pointers of Michael (IEEE TPDS 2004), one per thread.  A thread
+// publishes the node it is about to read, and a node may only be freed after
+// a scan finds it in no hazard pointer.  Since a protected node is never
+// freed, its address cannot be reused either, which also rules out ABA.
+class hazard_pointers {
+ public:
+  struct record {
+    std::atomic<const void *> hazard{nullptr};
+    std::atomic<bool> active{false};
+    record *next{nullptr};
+  };
+
+  static hazard_pointers &instance() {
+    static hazard_pointers domain;
+    return domain;
+  }
+
+  // The hazard pointer of this thread, given back when the thread exits.
+  static std::atomic<const void *> &mine() {
+    thread_local owner the_owner(&instance());
+    return the_owner.held->hazard;
+  }
+
+  // The number of threads that have ever held a hazard pointer at once.
+  std::size_t size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  // Return the sorted addresses protected at the moment.
+  std::vector<const void *> snapshot() const {
+    auto hazards = std::vector<const void *>();
+    hazards.reserve(size());
+    auto *r = head_.load(std::memory_order_acquire);
+    for (; r; r = r->next) {
+      if (auto *p = r->hazard.load(std::memory_order_seq_cst)) {
+        hazards.push_back(p);
+      }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    return hazards;
+  }
+
+ private:
+  // Records are reused by later threads and never freed, so there are never
+  // more of them than the peak number of threads.
+  struct owner {
+    record *held;
+    explicit owner(hazard_pointers *domain) : held(domain->acquire()) {}
+    ~owner() {
+      held->hazard.store(nullptr, std::memory_order_release);
+      held->active.store(false, std::memory_order_release);
+    }
+  };
+
+  record *acquire() {
+    for (auto *r = head_.load(std::memory_order_acquire); r; r = r->next) {
+      auto idle = false;
+      if (r->active.compare_exchange_strong(idle, true,
+                                            std::memory_order_acquire)) {
+        return r;
+      }
+    }
+    auto *r = new record;
+    r->active.store(true, std::memory_order_relaxed);
+    r->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(r->next, r,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return r;
+  }
+
+  std::atomic<record *> head_{nullptr};
+  std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace internal
+}  // namespace abc
+
+#endif  // ABC_HAZARD_POINTER_H_
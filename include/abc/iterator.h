@@ -3,6 +3,8 @@
 #define ABC_ITERATOR_H_
 
 #include <cstddef>
+#include <iterator>
+#include <type_traits>
 
 namespace abc {
 
@@ -19,6 +21,28 @@ template <class Category,
   using reference = Reference;
 };
 
+// Whether `It` is an iterator, which tells `(first, last)` from
+// `(count, value)` in overloaded constructors and methods.
+template <class It, class = void>
+struct is_iterator : std::false_type {};
+template <class It>
+struct is_iterator<It, std::void_t<
+    typename std::iterator_traits<It>::iterator_category>> : std::true_type {};
+template <class It>
+inline constexpr bool is_iterator_v = is_iterator<It>::value;
+
+// Whether `It` may be traversed more than once, so the distance of a range
+// can be measured before copying it.  False for non-iterators (e.g. `int`),
+// so it may also tell `(first, last)` from `(count, value)`.
+template <class It, class = void>
+struct is_forward_iterator : std::false_type {};
+template <class It>
+struct is_forward_iterator<It, std::enable_if_t<is_iterator_v<It>>>
+    : std::is_convertible<typename std::iterator_traits<It>::iterator_category,
+                          std::forward_iterator_tag> {};
+template <class It>
+inline constexpr bool is_forward_iterator_v = is_forward_iterator<It>::value;
+
 }  // namespace abc
 
 #endif  // ABC_ITERATOR_H_
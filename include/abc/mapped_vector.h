@@ -0,0 +1,373 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_MAPPED_VECTOR_H_
+#define ABC_MAPPED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "abc/algorithm.h"
+#include "abc/iterator.h"
+#include "abc/utility.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// How abc::mapped_vector maps its file.
+enum class map_mode {
+  kReadOnly,     // elements must not be written
+  kCopyOnWrite,  // written pages are private to this process
+  kReadWrite,    // the file is created if absent, and may grow
+};
+
+namespace internal {
+
+// The first bytes of the file of an abc::mapped_vector.  The elements start
+// at `kOffset`, which is aligned for any `T` of an alignment up to 64.
+struct mapped_header {
+  static constexpr char kMagic[8] = {'a', 'b', 'c', 'v', 'e', 'c', 0, 0};
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::size_t kOffset = 64;
+
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t value_size;
+  std::uint32_t value_align;
+  std::uint32_t reserved;
+  std::uint64_t size;
+};
+static_assert(sizeof(mapped_header) <= mapped_header::kOffset);
+
+}  // namespace internal
+
+// A vector whose elements live in a file mapped by `mmap`, so a table saved
+// by one process is loaded by another without reading or converting it.
+// Pages are read from the file (or the page cache) on first touch.
+//
+// The file holds an internal::mapped_header, which records the size of the
+// vector and is checked against `T` on opening, followed by the elements.
+// In `map_mode::kReadWrite`, the vector grows by `ftruncate` plus `mmap`,
+// and the header is kept up to date, so the file is valid after each call.
+//
+// Only trivially copyable types are supported, since their bytes are their
+// values.  The read interface is the same as that of abc::vector.
+template <class T, class GrowthPolicy = abc::growth_policy<>>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable types can be mapped.");
+  static_assert(alignof(T) <= internal::mapped_header::kOffset,
+                "Over-aligned types are not supported.");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+ private:
+  using header_type = internal::mapped_header;
+  static constexpr size_type kOffset = header_type::kOffset;
+
+  int fd_{-1};
+  map_mode mode_;
+  void *base_{nullptr};
+  size_type bytes_{0};  // of the file and of the mapping
+
+ public:
+  // Map the file at `path`, which must hold a vector of `T` unless it is
+  // opened in `map_mode::kReadWrite`, where a new or empty file is made an
+  // empty vector.
+  mapped_vector(const char *path, map_mode mode) : mode_(mode) {
+    auto flags = mode == map_mode::kReadWrite ? O_RDWR | O_CREAT : O_RDONLY;
+    fd_ = ::open(path, flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      internal::throw_errno(path);
+    }
+    try {
+      struct ::stat status;
+      if (::fstat(fd_, &status) != 0) {
+        internal::throw_errno("fstat");
+      }
+      auto bytes = static_cast<size_type>(status.st_size);
+      if (bytes == 0 && mode == map_mode::kReadWrite) {
+        truncate(kOffset);
+        base_ = map(kOffset);
+        bytes_ = kOffset;
+        auto h = header();
+        std::memcpy(h->magic, header_type::kMagic, sizeof(h->magic));
+        h->version = header_type::kVersion;
+        h->value_size = sizeof(T);
+        h->value_align = alignof(T);
+        h->reserved = 0;
+        h->size = 0;
+      } else {
+        check_bytes(bytes);
+        base_ = map(bytes);
+        bytes_ = bytes;
+        check_header();
+      }
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+  mapped_vector(const std::string &path, map_mode mode)
+      : mapped_vector(path.c_str(), mode) {}
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector &operator=(const mapped_vector &) = delete;
+  mapped_vector(mapped_vector &&that) noexcept
+      : fd_(std::exchange(that.fd_, -1)), mode_(that.mode_),
+        base_(std::exchange(that.base_, nullptr)),
+        bytes_(std::exchange(that.bytes_, 0)) {}
+  mapped_vector &operator=(mapped_vector &&that) noexcept {
+    if (this != &that) {
+      release();
+      fd_ = std::exchange(that.fd_, -1);
+      mode_ = that.mode_;
+      base_ = std::exchange(that.base_, nullptr);
+      bytes_ = std::exchange(that.bytes_, 0);
+    }
+    return *this;
+  }
+  ~mapped_vector() noexcept { release(); }
+
+  map_mode mode() const noexcept { return mode_; }
+
+  // iterator and related methods
+  iterator begin() noexcept { return array(); }
+  iterator end() noexcept { return array() + size(); }
+  const_iterator cbegin() const noexcept { return array(); }
+  const_iterator cend() const noexcept { return array() + size(); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+
+  // non-modifying methods
+  // A moved-from vector has no mapping, and is empty.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept { return base_ ? header()->size : 0; }
+  size_type capacity() const noexcept {
+    return base_ ? (bytes_ - kOffset) / sizeof(T) : 0;
+  }
+  // The most elements whose bytes, plus the header, fit in a `size_type`.
+  static constexpr size_type max_size() noexcept {
+    return (std::numeric_limits<size_type>::max() - kOffset) / sizeof(T);
+  }
+  T *data() noexcept { return array(); }
+  const T *data() const noexcept { return array(); }
+  // element accessors (without check), which must not write in
+  // `map_mode::kReadOnly`
+  reference operator[](size_type pos) { return array()[pos]; }
+  const_reference operator[](size_type pos) const { return array()[pos]; }
+  reference front() { return array()[0]; }
+  const_reference front() const { return array()[0]; }
+  reference back() { return array()[size() - 1]; }
+  const_reference back() const { return array()[size() - 1]; }
+  // element accessors (with check)
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return array()[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return array()[pos];
+  }
+
+  // capacity methods, which throw std::logic_error unless in
+  // `map_mode::kReadWrite`
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity()) {
+      reallocate(new_capacity);
+    }
+  }
+  void shrink_to_fit() {
+    if (capacity() > size()) {
+      reallocate(size());
+    }
+  }
+  // Write the dirty pages back to the file, and wait until they are written.
+  void flush() {
+    if (mode_ == map_mode::kReadWrite && ::msync(base_, bytes_, MS_SYNC)) {
+      internal::throw_errno("msync");
+    }
+  }
+
+  // modifying methods, which also throw std::logic_error unless in
+  // `map_mode::kReadWrite`
+  void resize(size_type count, const T &value = T()) {
+    if (count > max_size()) {
+      throw std::length_error("The given size is too large!");
+    }
+    // `value` may be an element, which growth unmaps, so copy it first:
+    auto copy = value;
+    if (count > capacity()) {
+      reallocate(grow(count));
+    }
+    require_writable();
+    std::uninitialized_fill(end(), begin() + std::max(count, size()), copy);
+    set_size(count);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+        typename std::iterator_traits<InputIt>::iterator_category>) {
+      reserve(std::distance(first, last));
+    }
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (size() == capacity()) {
+      if (size() == max_size()) {
+        throw std::length_error("The mapped_vector is full!");
+      }
+      // `args` may refer to an element, which growth unmaps, so build the
+      // new element before that:
+      auto value = T(std::forward<Args>(args)...);
+      reallocate(grow(size() + 1));
+      return construct_back(value);
+    }
+    require_writable();
+    return construct_back(std::forward<Args>(args)...);
+  }
+  void push_back(const T &value) { emplace_back(value); }
+  void pop_back() {
+    require_writable();
+    set_size(size() - 1);
+  }
+  void clear() {
+    require_writable();
+    set_size(0);
+  }
+
+ private:
+  header_type *header() const noexcept {
+    return static_cast<header_type *>(base_);
+  }
+  T *array() const noexcept {
+    return reinterpret_cast<T *>(static_cast<char *>(base_) + kOffset);
+  }
+  void set_size(size_type n) noexcept { header()->size = n; }
+  template <class... Args>
+  reference construct_back(Args &&...args) {
+    auto p = new (array() + size()) T(std::forward<Args>(args)...);
+    set_size(size() + 1);
+    return *p;
+  }
+  // The capacity to grow to for `count` elements, which never exceeds
+  // `max_size()`.
+  size_type grow(size_type count) const noexcept {
+    return std::min(GrowthPolicy::grow(size(), count), max_size());
+  }
+  void require_writable() const {
+    if (mode_ != map_mode::kReadWrite) {
+      throw std::logic_error("The vector is not opened to be resized!");
+    }
+  }
+  void check_bytes(size_type bytes) const {
+    if (bytes < kOffset) {
+      throw std::runtime_error("The file is too short to hold a header!");
+    }
+  }
+  void check_header() const {
+    auto h = header();
+    if (std::memcmp(h->magic, header_type::kMagic, sizeof(h->magic))) {
+      throw std::runtime_error("The file does not hold a mapped_vector!");
+    }
+    if (h->version != header_type::kVersion) {
+      throw std::runtime_error("The file has an unknown version!");
+    }
+    if (h->value_size != sizeof(T) || h->value_align != alignof(T)) {
+      throw std::runtime_error("The file holds elements of another type!");
+    }
+    if (h->size > capacity()) {
+      throw std::runtime_error("The file is shorter than its elements!");
+    }
+  }
+  void *map(size_type bytes) const {
+    auto prot = mode_ == map_mode::kReadOnly ? PROT_READ
+                                             : PROT_READ | PROT_WRITE;
+    auto flags = mode_ == map_mode::kCopyOnWrite ? MAP_PRIVATE : MAP_SHARED;
+    auto p = ::mmap(nullptr, bytes, prot, flags, fd_, 0);
+    if (p == MAP_FAILED) {
+      internal::throw_errno("mmap");
+    }
+    return p;
+  }
+  void truncate(size_type bytes) const {
+    if (::ftruncate(fd_, bytes) != 0) {
+      internal::throw_errno("ftruncate");
+    }
+  }
+  // Resize the file to hold `new_capacity` elements and map it again.  The
+  // old mapping is kept until the new one is ready, so a throw changes
+  // nothing but the length of the file.
+  void reallocate(size_type new_capacity) {
+    require_writable();
+    // A wrapped-around byte count would truncate the file:
+    if (new_capacity > max_size()) {
+      throw std::length_error("The given capacity is too large!");
+    }
+    auto new_bytes = kOffset + new_capacity * sizeof(T);
+    if (new_bytes > bytes_) {
+      truncate(new_bytes);
+    }
+    auto p = map(new_bytes);
+    ::munmap(base_, bytes_);
+    base_ = p;
+    if (new_bytes < bytes_) {
+      truncate(new_bytes);
+    }
+    bytes_ = new_bytes;
+  }
+  void release() noexcept {
+    if (base_) {
+      ::munmap(base_, bytes_);
+      base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+};
+
+template <class T, class GrowthPolicy>
+bool operator==(const mapped_vector<T, GrowthPolicy> &lhs,
+                const mapped_vector<T, GrowthPolicy> &rhs) noexcept {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class T, class GrowthPolicy>
+bool operator!=(const mapped_vector<T, GrowthPolicy> &lhs,
+                const mapped_vector<T, GrowthPolicy> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_MAPPED_VECTOR_H_
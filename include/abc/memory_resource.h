@@ -0,0 +1,680 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_MEMORY_RESOURCE_H_
+#define ABC_MEMORY_RESOURCE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <new>
+#include <type_traits>
+
+namespace abc {
+
+// The interface of classes that encapsulate memory resources.
+class memory_resource {
+  static constexpr std::size_t max_align = alignof(std::max_align_t);
+
+ public:
+  virtual ~memory_resource() = default;
+  void *allocate(std::size_t bytes, std::size_t alignment = max_align) {
+    return do_allocate(bytes, alignment);
+  }
+  void deallocate(void *p, std::size_t bytes,
+                  std::size_t alignment = max_align) {
+    do_deallocate(p, bytes, alignment);
+  }
+  bool is_equal(const memory_resource &that) const noexcept {
+    return do_is_equal(that);
+  }
+
+ private:
+  virtual void *do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+  virtual void do_deallocate(void *p, std::size_t bytes,
+                             std::size_t alignment) = 0;
+  virtual bool do_is_equal(const memory_resource &that) const noexcept = 0;
+};
+inline bool operator==(const memory_resource &lhs,
+                       const memory_resource &rhs) noexcept {
+  return &lhs == &rhs || lhs.is_equal(rhs);
+}
+inline bool operator!=(const memory_resource &lhs,
+                       const memory_resource &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+// The resource calling the global `operator new` and `operator delete`.
+inline memory_resource *new_delete_resource() noexcept {
+  class resource : public memory_resource {
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+      return ::operator new(bytes, std::align_val_t(alignment));
+    }
+    void do_deallocate(void *p, std::size_t bytes,
+                       std::size_t alignment) override {
+      ::operator delete(p, bytes, std::align_val_t(alignment));
+    }
+    bool do_is_equal(const memory_resource &that) const noexcept override {
+      return this == &that;
+    }
+  };
+  static resource instance;
+  return &instance;
+}
+// The resource throwing `std::bad_alloc` on every allocation.
+inline memory_resource *null_memory_resource() noexcept {
+  class resource : public memory_resource {
+    void *do_allocate(std::size_t, std::size_t) override {
+      throw std::bad_alloc();
+    }
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+    bool do_is_equal(const memory_resource &that) const noexcept override {
+      return this == &that;
+    }
+  };
+  static resource instance;
+  return &instance;
+}
+
+namespace internal {
+inline std::atomic<memory_resource *> &default_resource() noexcept {
+  static std::atomic<memory_resource *> resource{new_delete_resource()};
+  return resource;
+}
+inline std::size_t align_up(std::size_t n, std::size_t alignment) noexcept {
+  return (n + alignment - 1) & ~(alignment - 1);
+}
+}  // namespace internal
+
+inline memory_resource *get_default_resource() noexcept {
+  return internal::default_resource().load();
+}
+// Set the default resource (`new_delete_resource()` if `nullptr` is given),
+// and return the previous one.
+inline memory_resource *set_default_resource(memory_resource *r) noexcept {
+  return internal::default_resource().exchange(
+      r ? r : new_delete_resource());
+}
+
+// A resource that releases memory only when it is destroyed or `release()`d.
+// Each allocation bumps a pointer in the current buffer, which is the given
+// (e.g. stack) buffer at the beginning. When it is exhausted, a new buffer,
+// whose size grows geometrically, is obtained from the upstream resource.
+class monotonic_buffer_resource : public memory_resource {
+  // The header at the beginning of each buffer obtained from upstream.
+  struct Chunk {
+    Chunk *next;
+    std::size_t size;
+  };
+  static constexpr std::size_t kDefaultSize = 1024;
+  static constexpr std::size_t kGrowthFactor = 2;
+
+ public:
+  explicit monotonic_buffer_resource(
+      memory_resource *upstream = get_default_resource())
+      : monotonic_buffer_resource(kDefaultSize, upstream) {}
+  explicit monotonic_buffer_resource(
+      std::size_t initial_size,
+      memory_resource *upstream = get_default_resource())
+      : upstream_(upstream),
+        initial_next_size_(std::max(initial_size, sizeof(Chunk))),
+        next_size_(initial_next_size_) {}
+  monotonic_buffer_resource(
+      void *buffer, std::size_t buffer_size,
+      memory_resource *upstream = get_default_resource())
+      : upstream_(upstream),
+        initial_buffer_(static_cast<char *>(buffer)),
+        initial_size_(buffer_size),
+        initial_next_size_(
+            std::max(buffer_size * kGrowthFactor, kDefaultSize)),
+        current_(initial_buffer_), end_(initial_buffer_ + buffer_size),
+        next_size_(initial_next_size_) {}
+  monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+  monotonic_buffer_resource &operator=(
+      const monotonic_buffer_resource &) = delete;
+  ~monotonic_buffer_resource() noexcept override { release(); }
+
+  // Return all memory to upstream, and restart from the initial buffer.
+  void release() noexcept {
+    while (chunks_) {
+      auto chunk = chunks_;
+      chunks_ = chunk->next;
+      upstream_->deallocate(chunk, chunk->size, alignof(Chunk));
+    }
+    current_ = initial_buffer_;
+    end_ = initial_buffer_ + initial_size_;
+    next_size_ = initial_next_size_;
+  }
+  memory_resource *upstream_resource() const noexcept { return upstream_; }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (auto p = bump(bytes, alignment)) {
+      return p;
+    }
+    // Get a new chunk, which is large enough for the current request:
+    if (bytes > std::numeric_limits<std::size_t>::max() / kGrowthFactor) {
+      throw std::bad_alloc();
+    }
+    auto size = std::max(next_size_, sizeof(Chunk) + bytes + alignment);
+    auto chunk = static_cast<Chunk *>(upstream_->allocate(size,
+                                                          alignof(Chunk)));
+    chunk->next = chunks_;
+    chunk->size = size;
+    chunks_ = chunk;
+    current_ = reinterpret_cast<char *>(chunk + 1);
+    end_ = reinterpret_cast<char *>(chunk) + size;
+    next_size_ = size * kGrowthFactor;
+    return bump(bytes, alignment);
+  }
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+  bool do_is_equal(const memory_resource &that) const noexcept override {
+    return this == &that;
+  }
+  void *bump(std::size_t bytes, std::size_t alignment) noexcept {
+    if (!current_) {
+      return nullptr;
+    }
+    auto address = reinterpret_cast<std::uintptr_t>(current_);
+    auto padding = internal::align_up(address, alignment) - address;
+    if (padding > std::size_t(end_ - current_) ||
+        bytes > std::size_t(end_ - current_) - padding) {
+      return nullptr;
+    }
+    auto p = current_ + padding;
+    current_ = p + bytes;
+    return p;
+  }
+
+ private:
+  memory_resource *upstream_;
+  char *initial_buffer_{nullptr};
+  std::size_t initial_size_{0};
+  std::size_t initial_next_size_;
+  char *current_{nullptr};
+  char *end_{nullptr};
+  std::size_t next_size_;
+  Chunk *chunks_{nullptr};
+};
+
+// Options for constructing pool resources.
+struct pool_options {
+  // The maximum number of blocks in a chunk (0 for the default value).
+  std::size_t max_blocks_per_chunk = 0;
+  // The largest block served by pools (0 for the default value).
+  // Larger requests are forwarded to the upstream resource.
+  std::size_t largest_required_pool_block = 0;
+};
+
+// A resource holding a pool for each size class (a power of 2).
+// Each pool gets chunks of blocks from upstream, and recycles deallocated
+// blocks in a free list. Not thread-safe.
+class unsynchronized_pool_resource : public memory_resource {
+  // A free block is linked into the free list of its pool.
+  struct Block {
+    Block *next;
+  };
+  // The footer at the end of each chunk obtained from upstream.
+  struct Chunk {
+    Chunk *next;
+    std::size_t size;
+    std::size_t alignment;
+  };
+  struct Pool {
+    Block *free_list{nullptr};
+    char *current{nullptr};  // the unused part of the newest chunk
+    char *end{nullptr};
+    Chunk *chunks{nullptr};
+    std::size_t next_blocks{0};
+  };
+  // The header before each block obtained directly from upstream.
+  struct Large {
+    Large *prev;
+    Large *next;
+    std::size_t size;
+    std::size_t alignment;
+  };
+  static constexpr std::size_t kMinBlock = sizeof(Block);
+  static constexpr std::size_t kMaxBlock = std::size_t(1) << 20;
+  static constexpr std::size_t kMaxPools = 18;  // 8 bytes to 1 MiB
+  static constexpr std::size_t kFirstBlocks = 16;
+
+ public:
+  unsynchronized_pool_resource(const pool_options &options,
+                               memory_resource *upstream)
+      : upstream_(upstream), options_(options) {
+    auto &max_blocks = options_.max_blocks_per_chunk;
+    if (max_blocks == 0) {
+      max_blocks = 4096;
+    }
+    max_blocks = std::max(max_blocks, kFirstBlocks);
+    auto &largest = options_.largest_required_pool_block;
+    if (largest == 0) {
+      largest = 4096;
+    }
+    largest = block_size(std::min(largest, kMaxBlock));
+  }
+  unsynchronized_pool_resource()
+      : unsynchronized_pool_resource(pool_options(), get_default_resource()) {
+  }
+  explicit unsynchronized_pool_resource(memory_resource *upstream)
+      : unsynchronized_pool_resource(pool_options(), upstream) {}
+  explicit unsynchronized_pool_resource(const pool_options &options)
+      : unsynchronized_pool_resource(options, get_default_resource()) {}
+  unsynchronized_pool_resource(const unsynchronized_pool_resource &) = delete;
+  unsynchronized_pool_resource &operator=(
+      const unsynchronized_pool_resource &) = delete;
+  ~unsynchronized_pool_resource() noexcept override { release(); }
+
+  // Return all memory to upstream, even if some blocks are still in use.
+  void release() noexcept {
+    for (auto &pool : pools_) {
+      while (pool.chunks) {
+        auto chunk = pool.chunks;
+        pool.chunks = chunk->next;
+        auto base = reinterpret_cast<char *>(chunk + 1) - chunk->size;
+        upstream_->deallocate(base, chunk->size, chunk->alignment);
+      }
+      pool = Pool();
+    }
+    while (larges_) {
+      auto large = larges_;
+      larges_ = large->next;
+      upstream_->deallocate(base_of(large), large->size, large->alignment);
+    }
+  }
+  memory_resource *upstream_resource() const noexcept { return upstream_; }
+  pool_options options() const noexcept { return options_; }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    auto size = block_size(std::max(bytes, alignment));
+    if (size > options_.largest_required_pool_block) {
+      return allocate_large(bytes, alignment);
+    }
+    auto &pool = pools_[index(size)];
+    if (auto block = pool.free_list) {
+      pool.free_list = block->next;
+      return block;
+    }
+    if (pool.current == pool.end) {
+      add_chunk(&pool, size);
+    }
+    auto p = pool.current;
+    pool.current += size;
+    return p;
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    auto size = block_size(std::max(bytes, alignment));
+    if (size > options_.largest_required_pool_block) {
+      deallocate_large(p);
+    } else {
+      auto &pool = pools_[index(size)];
+      auto block = static_cast<Block *>(p);
+      block->next = pool.free_list;
+      pool.free_list = block;
+    }
+  }
+  bool do_is_equal(const memory_resource &that) const noexcept override {
+    return this == &that;
+  }
+  // Round `bytes` up to the nearest size class.
+  static std::size_t block_size(std::size_t bytes) noexcept {
+    auto size = kMinBlock;
+    while (size < bytes) {
+      size *= 2;
+    }
+    return size;
+  }
+  static std::size_t index(std::size_t size) noexcept {
+    std::size_t i = 0;
+    while ((kMinBlock << i) < size) {
+      ++i;
+    }
+    return i;
+  }
+  // Get a chunk of blocks aligned to `size`, and put its footer at the end.
+  void add_chunk(Pool *pool, std::size_t size) {
+    if (pool->next_blocks == 0) {
+      pool->next_blocks = kFirstBlocks;
+    }
+    auto blocks_size = pool->next_blocks * size;
+    auto chunk_size = blocks_size + internal::align_up(sizeof(Chunk), size);
+    auto base = static_cast<char *>(upstream_->allocate(chunk_size, size));
+    auto chunk = reinterpret_cast<Chunk *>(base + chunk_size) - 1;
+    chunk->next = pool->chunks;
+    chunk->size = chunk_size;
+    chunk->alignment = size;
+    pool->chunks = chunk;
+    pool->current = base;
+    pool->end = base + blocks_size;
+    pool->next_blocks = std::min(pool->next_blocks * 2,
+                                 options_.max_blocks_per_chunk);
+  }
+  static std::size_t large_offset(std::size_t alignment) noexcept {
+    return internal::align_up(sizeof(Large), alignment);
+  }
+  static char *base_of(Large *large) noexcept {
+    return reinterpret_cast<char *>(large + 1) - large_offset(large->alignment);
+  }
+  void *allocate_large(std::size_t bytes, std::size_t alignment) {
+    alignment = std::max(alignment, alignof(Large));
+    auto offset = large_offset(alignment);
+    if (bytes > std::numeric_limits<std::size_t>::max() - offset) {
+      throw std::bad_alloc();
+    }
+    auto base = static_cast<char *>(
+        upstream_->allocate(offset + bytes, alignment));
+    auto large = reinterpret_cast<Large *>(base + offset) - 1;
+    large->prev = nullptr;
+    large->next = larges_;
+    large->size = offset + bytes;
+    large->alignment = alignment;
+    if (larges_) {
+      larges_->prev = large;
+    }
+    larges_ = large;
+    return base + offset;
+  }
+  void deallocate_large(void *p) {
+    auto large = static_cast<Large *>(p) - 1;
+    if (large->prev) {
+      large->prev->next = large->next;
+    } else {
+      larges_ = large->next;
+    }
+    if (large->next) {
+      large->next->prev = large->prev;
+    }
+    upstream_->deallocate(base_of(large), large->size, large->alignment);
+  }
+
+ private:
+  memory_resource *upstream_;
+  pool_options options_;
+  Pool pools_[kMaxPools];
+  Large *larges_{nullptr};
+};
+
+// The thread-safe version of `unsynchronized_pool_resource`.
+class synchronized_pool_resource : public memory_resource {
+ public:
+  synchronized_pool_resource(const pool_options &options,
+                             memory_resource *upstream)
+      : pools_(options, upstream) {}
+  synchronized_pool_resource()
+      : synchronized_pool_resource(pool_options(), get_default_resource()) {}
+  explicit synchronized_pool_resource(memory_resource *upstream)
+      : synchronized_pool_resource(pool_options(), upstream) {}
+  explicit synchronized_pool_resource(const pool_options &options)
+      : synchronized_pool_resource(options, get_default_resource()) {}
+  synchronized_pool_resource(const synchronized_pool_resource &) = delete;
+  synchronized_pool_resource &operator=(
+      const synchronized_pool_resource &) = delete;
+  ~synchronized_pool_resource() noexcept override = default;
+
+  void release() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pools_.release();
+  }
+  memory_resource *upstream_resource() const noexcept {
+    return pools_.upstream_resource();
+  }
+  pool_options options() const noexcept { return pools_.options(); }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pools_.allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pools_.deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &that) const noexcept override {
+    return this == &that;
+  }
+
+ private:
+  std::mutex mutex_;
+  unsynchronized_pool_resource pools_;
+};
+
+// An allocator that delegates to a `memory_resource` given at runtime,
+// so containers using different resources have the same type.
+// It is never propagated by container assignment or swap.
+template <class T>
+class polymorphic_allocator {
+  template <class U> friend class polymorphic_allocator;
+
+ public:
+  using value_type = T;
+
+ public:
+  polymorphic_allocator() noexcept : resource_(get_default_resource()) {}
+  polymorphic_allocator(memory_resource *r) noexcept  // NOLINT
+      : resource_(r) {}
+  polymorphic_allocator(const polymorphic_allocator &) = default;
+  template <class U>
+  polymorphic_allocator(const polymorphic_allocator<U> &that)  // NOLINT
+      noexcept : resource_(that.resource_) {}
+  polymorphic_allocator &operator=(const polymorphic_allocator &) = delete;
+
+  T *allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(resource_->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *p, std::size_t n) {
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+  polymorphic_allocator select_on_container_copy_construction() const {
+    return polymorphic_allocator();
+  }
+  memory_resource *resource() const noexcept { return resource_; }
+
+ private:
+  memory_resource *resource_;
+};
+template <class T, class U>
+bool operator==(const polymorphic_allocator<T> &lhs,
+                const polymorphic_allocator<U> &rhs) noexcept {
+  return *lhs.resource() == *rhs.resource();
+}
+template <class T, class U>
+bool operator!=(const polymorphic_allocator<T> &lhs,
+                const polymorphic_allocator<U> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+namespace internal {
+
+// A pool of fixed-size blocks, which are carved from chunks (obtained from
+// upstream and growing geometrically) and recycled through a free list.
+class slab_pool {
+  struct Block {
+    Block *next;
+  };
+  // The header at the beginning of each chunk.
+  struct Chunk {
+    Chunk *next;
+    std::size_t size;
+  };
+  static constexpr std::size_t kFirstBlocks = 32;
+  static constexpr std::size_t kMaxBlocks = 8192;
+
+ public:
+  slab_pool(std::size_t size, std::size_t alignment,
+            memory_resource *upstream)
+      : upstream_(upstream),
+        alignment_(std::max(alignment, alignof(Chunk))),
+        block_size_(align_up(std::max(size, sizeof(Block)), alignment_)),
+        offset_(align_up(sizeof(Chunk), alignment_)) {}
+  slab_pool(const slab_pool &) = delete;
+  slab_pool &operator=(const slab_pool &) = delete;
+  ~slab_pool() noexcept {
+    while (chunks_) {
+      auto chunk = chunks_;
+      chunks_ = chunk->next;
+      upstream_->deallocate(chunk, chunk->size, alignment_);
+    }
+  }
+  std::size_t block_size() const noexcept { return block_size_; }
+  std::size_t alignment() const noexcept { return alignment_; }
+  void *allocate() {
+    if (auto block = free_list_) {
+      free_list_ = block->next;
+      return block;
+    }
+    if (current_ == end_) {
+      add_chunk();
+    }
+    auto p = current_;
+    current_ += block_size_;
+    return p;
+  }
+  void deallocate(void *p) noexcept {
+    auto block = static_cast<Block *>(p);
+    block->next = free_list_;
+    free_list_ = block;
+  }
+
+ private:
+  void add_chunk() {
+    auto size = offset_ + next_blocks_ * block_size_;
+    auto chunk = static_cast<Chunk *>(upstream_->allocate(size, alignment_));
+    chunk->next = chunks_;
+    chunk->size = size;
+    chunks_ = chunk;
+    current_ = reinterpret_cast<char *>(chunk) + offset_;
+    end_ = reinterpret_cast<char *>(chunk) + size;
+    next_blocks_ = std::min(next_blocks_ * 2, kMaxBlocks);
+  }
+
+ private:
+  memory_resource *upstream_;
+  std::size_t alignment_;
+  std::size_t block_size_;
+  std::size_t offset_;  // from the beginning of a chunk to its first block
+  Block *free_list_{nullptr};
+  char *current_{nullptr};  // the unused part of the newest chunk
+  char *end_{nullptr};
+  Chunk *chunks_{nullptr};
+  std::size_t next_blocks_{kFirstBlocks};
+};
+
+// The `slab_pool`s for different block sizes, shared by a `pool_allocator`
+// and all its copies (including rebound ones).
+class slab_pools {
+  struct Entry {
+    slab_pool pool;
+    Entry *next;
+  };
+
+ public:
+  explicit slab_pools(memory_resource *upstream) : upstream_(upstream) {}
+  slab_pools(const slab_pools &) = delete;
+  slab_pools &operator=(const slab_pools &) = delete;
+  ~slab_pools() noexcept {
+    while (entries_) {
+      auto entry = entries_;
+      entries_ = entry->next;
+      delete entry;
+    }
+  }
+  memory_resource *upstream() const noexcept { return upstream_; }
+  // Get the pool for blocks of the given size and alignment.
+  slab_pool *get(std::size_t size, std::size_t alignment) {
+    auto key = slab_pool(size, alignment, upstream_);
+    for (auto entry = entries_; entry; entry = entry->next) {
+      if (entry->pool.block_size() == key.block_size() &&
+          entry->pool.alignment() == key.alignment()) {
+        return &entry->pool;
+      }
+    }
+    entries_ = new Entry{{size, alignment, upstream_}, entries_};
+    return &entries_->pool;
+  }
+
+ private:
+  memory_resource *upstream_;
+  Entry *entries_{nullptr};
+};
+
+}  // namespace internal
+
+// An allocator serving single objects (e.g. nodes of `abc::forward_list`)
+// from a pool of fixed-size blocks, which are carved from chunks obtained
+// from `upstream` and recycled through a free list. Arrays are forwarded to
+// `upstream`. Copies (including rebound ones) share the pools and compare
+// equal, and the memory is returned to `upstream` when the last copy dies.
+// Not thread-safe.
+template <class T>
+class pool_allocator {
+  template <class U> friend class pool_allocator;
+
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+ public:
+  pool_allocator() : pool_allocator(get_default_resource()) {}
+  explicit pool_allocator(memory_resource *upstream)
+      : pools_(std::make_shared<internal::slab_pools>(upstream)) {}
+  // No move operations, so moving copies `pools_` instead of nulling it.  A
+  // container moved from keeps a usable allocator, which still compares equal
+  // to (and frees nodes allocated by) the one its nodes were moved to.
+  pool_allocator(const pool_allocator &) noexcept = default;
+  pool_allocator &operator=(const pool_allocator &) noexcept = default;
+  template <class U>
+  pool_allocator(const pool_allocator<U> &that) noexcept  // NOLINT
+      : pools_(that.pools_) {}
+
+  T *allocate(std::size_t n) {
+    if (n == 1) {
+      return static_cast<T *>(pool()->allocate());
+    }
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(
+        pools_->upstream()->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *p, std::size_t n) {
+    if (n == 1) {
+      pool()->deallocate(p);
+    } else {
+      pools_->upstream()->deallocate(p, n * sizeof(T), alignof(T));
+    }
+  }
+  template <class U>
+  bool operator==(const pool_allocator<U> &that) const noexcept {
+    return pools_ == that.pools_;
+  }
+  template <class U>
+  bool operator!=(const pool_allocator<U> &that) const noexcept {
+    return !operator==(that);
+  }
+
+ private:
+  internal::slab_pool *pool() {
+    if (!pool_) {
+      pool_ = pools_->get(sizeof(T), alignof(T));
+    }
+    return pool_;
+  }
+
+ private:
+  std::shared_ptr<internal::slab_pools> pools_;
+  internal::slab_pool *pool_{nullptr};  // the one for `T`, found lazily
+};
+
+}  // namespace abc
+
+#endif  // ABC_MEMORY_RESOURCE_H_
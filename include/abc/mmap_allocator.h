@@ -0,0 +1,152 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_MMAP_ALLOCATOR_H_
+#define ABC_MMAP_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace abc {
+
+// An allocator for buffers that may grow very large, e.g. the array of an
+// abc::vector of a trivially relocatable type.
+//
+// Blocks of at least `kThreshold` bytes are mapped by `mmap` (on Linux) and
+// advised to be backed by transparent huge pages, which cuts TLB misses.
+// Smaller blocks come from `std::malloc`.  Besides, `reallocate()` resizes a
+// block without copying if possible (by `mremap` or `std::realloc`), which
+// abc::vector uses to grow in place.
+template <class T, std::size_t kThreshold = std::size_t(1) << 21>
+class mmap_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "Over-aligned types are not supported.");
+
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+  template <class U>
+  struct rebind { using other = mmap_allocator<U, kThreshold>; };
+
+  mmap_allocator() noexcept = default;
+  template <class U>
+  mmap_allocator(const mmap_allocator<U, kThreshold> &) noexcept {}  // NOLINT
+
+  static constexpr std::size_t max_size() noexcept {
+    return std::numeric_limits<std::size_t>::max() / sizeof(T);
+  }
+  T *allocate(std::size_t n) {
+    if (n > max_size()) {
+      throw std::bad_array_new_length();
+    }
+    auto bytes = n * sizeof(T);
+    void *p;
+    if (is_mapped(bytes)) {
+      p = map(bytes);
+    } else {
+      p = std::malloc(bytes);
+    }
+    if (!p && bytes) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(p);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    auto bytes = n * sizeof(T);
+    if (is_mapped(bytes)) {
+      unmap(p, bytes);
+    } else {
+      std::free(p);
+    }
+  }
+  // Resize the block `p` of `old_n` objects to hold `new_n` objects, as if by
+  // `std::realloc`.  The first `min(old_n, new_n)` objects are kept bitwise,
+  // so `T` must be trivially relocatable.
+  T *reallocate(T *p, std::size_t old_n, std::size_t new_n) {
+    if (new_n > max_size()) {
+      throw std::bad_array_new_length();
+    }
+    auto old_bytes = old_n * sizeof(T), new_bytes = new_n * sizeof(T);
+    void *q;
+    if (is_mapped(old_bytes) && is_mapped(new_bytes)) {
+      q = remap(p, old_bytes, new_bytes);
+    } else if (!is_mapped(old_bytes) && !is_mapped(new_bytes)) {
+      q = std::realloc(p, new_bytes);
+    } else {
+      q = allocate(new_n);
+      std::memcpy(q, static_cast<void *>(p), std::min(old_bytes, new_bytes));
+      deallocate(p, old_n);
+    }
+    if (!q && new_bytes) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(q);
+  }
+
+ private:
+#ifdef __linux__
+  static bool is_mapped(std::size_t bytes) noexcept {
+    return bytes >= kThreshold;
+  }
+  static std::size_t round_up(std::size_t bytes) noexcept {
+    static const std::size_t page_size = ::sysconf(_SC_PAGESIZE);
+    return (bytes + page_size - 1) / page_size * page_size;
+  }
+  static void *map(std::size_t bytes) noexcept {
+    bytes = round_up(bytes);
+    auto p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      return nullptr;
+    }
+    ::madvise(p, bytes, MADV_HUGEPAGE);
+    return p;
+  }
+  static void *remap(void *p, std::size_t old_bytes,
+                     std::size_t new_bytes) noexcept {
+    old_bytes = round_up(old_bytes);
+    new_bytes = round_up(new_bytes);
+    auto q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (q == MAP_FAILED) {
+      return nullptr;
+    }
+    if (new_bytes > old_bytes) {
+      ::madvise(q, new_bytes, MADV_HUGEPAGE);
+    }
+    return q;
+  }
+  static void unmap(void *p, std::size_t bytes) noexcept {
+    ::munmap(p, round_up(bytes));
+  }
+#else
+  // Elsewhere, every block comes from `std::malloc`.
+  static bool is_mapped(std::size_t) noexcept { return false; }
+  static void *map(std::size_t) noexcept { return nullptr; }
+  static void *remap(void *, std::size_t, std::size_t) noexcept {
+    return nullptr;
+  }
+  static void unmap(void *, std::size_t) noexcept {}
+#endif
+};
+template <class T, class U, std::size_t kThreshold>
+bool operator==(const mmap_allocator<T, kThreshold> &,
+                const mmap_allocator<U, kThreshold> &) noexcept {
+  return true;
+}
+template <class T, class U, std::size_t kThreshold>
+bool operator!=(const mmap_allocator<T, kThreshold> &,
+                const mmap_allocator<U, kThreshold> &) noexcept {
+  return false;
+}
+
+}  // namespace abc
+
+#endif  // ABC_MMAP_ALLOCATOR_H_
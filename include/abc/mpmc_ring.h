@@ -0,0 +1,192 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_MPMC_RING_H_
+#define ABC_MPMC_RING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "abc/spsc_ring.h"
+#include "abc/stats.h"
+#include "abc/utility.h"
+
+namespace abc {
+
+// A bounded queue between any number of producer and consumer threads,
+// whose slots are allocated once, in a power-of-2 ring (Vyukov, "Bounded
+// MPMC queue", 2010).
+//
+// Each slot has a sequence number, which tells whether it is ready for the
+// push of index `i` (`i`) or for the pop of index `i` (`i + 1`).  A thread
+// claims an index by CAS on the tail or the head, after seeing the sequence
+// it needs, and hands the slot over to the other side by storing the next
+// sequence, so that producers and consumers only meet on the slots.
+//
+// A claimed slot must be filled, so an element that might throw on
+// construction is built before claiming a slot and then moved into it.
+// Any thread may call `try_push()`, `try_emplace()` and `try_pop()` at any
+// time; the others need exclusive access.
+template <class T, class Allocator = std::allocator<T>>
+class mpmc_ring {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "A claimed slot must not be left empty by a throw.");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+ private:
+  struct Slot {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char bytes[sizeof(T)];
+    T *value() noexcept { return reinterpret_cast<T *>(bytes); }
+  };
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using slot_alloc_traits = typename alloc_traits::template rebind_traits<Slot>;
+  using SlotAllocator = typename slot_alloc_traits::allocator_type;
+  // The slots are stored together with the allocator, and never change:
+  struct Ring : abc::ebo_storage<SlotAllocator> {
+    using abc::ebo_storage<SlotAllocator>::ebo_storage;
+    Slot *slots;
+    size_type mask;
+  };
+  Ring ring_;
+  alignas(64) std::atomic<size_type> tail_{0};
+  alignas(64) std::atomic<size_type> head_{0};
+
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<mpmc_ring>(s, n);
+  }
+
+ public:
+  // Hold at least `capacity` elements, rounded up to a power of 2.
+  explicit mpmc_ring(size_type capacity,
+                     const Allocator &alloc = Allocator())
+      : ring_(SlotAllocator(alloc)) {
+    capacity = internal::ring_capacity(capacity);
+    ring_.slots = slot_alloc_traits::allocate(slot_allocator(), capacity);
+    ring_.mask = capacity - 1;
+    record(stat::kAllocations);
+    for (size_type i = 0; i != capacity; ++i) {
+      ::new (&ring_.slots[i].sequence) std::atomic<size_type>(i);
+    }
+  }
+  mpmc_ring(const mpmc_ring &) = delete;
+  mpmc_ring &operator=(const mpmc_ring &) = delete;
+  ~mpmc_ring() noexcept {
+    auto tail = tail_.load(std::memory_order_acquire);
+    for (auto i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      destroy(slot(i));
+    }
+    slot_alloc_traits::deallocate(slot_allocator(), ring_.slots, capacity());
+    record(stat::kDeallocations);
+  }
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(ring_.get());
+  }
+
+  size_type capacity() const noexcept { return ring_.mask + 1; }
+  // May be stale once returned, if other threads push or pop.
+  size_type size() const noexcept {
+    auto head = head_.load(std::memory_order_acquire);
+    auto tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  // Construct an element at the tail and return true, or return false if
+  // the ring is full.
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+      size_type tail;
+      if (!claim_tail(&tail)) {
+        return false;
+      }
+      auto s = slot(tail);
+      construct(s->value(), std::forward<Args>(args)...);
+      // ready for the pop of index `tail`:
+      s->sequence.store(tail + 1, std::memory_order_release);
+      return true;
+    } else {
+      return try_push(T(std::forward<Args>(args)...));
+    }
+  }
+  bool try_push(const T &value) {
+    if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+      return try_emplace(value);
+    } else {
+      return try_push(T(value));
+    }
+  }
+  bool try_push(T &&value) { return try_emplace(abc::move(value)); }
+
+  // Pop the head and return its value, or return `std::nullopt` if empty.
+  std::optional<T> try_pop() {
+    auto head = head_.load(std::memory_order_relaxed);
+    while (true) {
+      auto s = slot(head);
+      auto sequence = s->sequence.load(std::memory_order_acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+      if (lag == 0) {
+        if (head_.compare_exchange_weak(head, head + 1,
+                                        std::memory_order_relaxed)) {
+          auto value = std::optional<T>(abc::move(*s->value()));
+          record(stat::kMoves);
+          destroy(s);
+          // ready for the push of index `head + capacity()`:
+          s->sequence.store(head + capacity(), std::memory_order_release);
+          return value;
+        }
+      } else if (lag < 0) {
+        return std::nullopt;  // not yet pushed
+      } else {
+        head = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  SlotAllocator &slot_allocator() noexcept { return ring_.get(); }
+  Slot *slot(size_type i) const noexcept {
+    return ring_.slots + (i & ring_.mask);
+  }
+  // Claim the slot at the tail and store its index in `index`, or return
+  // false if the ring is full.
+  bool claim_tail(size_type *index) noexcept {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      auto sequence = slot(tail)->sequence.load(std::memory_order_acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - tail);
+      if (lag == 0) {
+        if (tail_.compare_exchange_weak(tail, tail + 1,
+                                        std::memory_order_relaxed)) {
+          *index = tail;
+          return true;
+        }
+      } else if (lag < 0) {
+        return false;  // not yet popped
+      } else {
+        tail = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+  template <class... Args>
+  void construct(T *p, Args &&...args) noexcept {
+    ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+    internal::count_construction<mpmc_ring, T, Args...>();
+  }
+  void destroy(Slot *s) noexcept {
+    s->value()->~T();
+    record(stat::kDestructions);
+  }
+};  // mpmc_ring
+
+}  // namespace abc
+
+#endif  // ABC_MPMC_RING_H_
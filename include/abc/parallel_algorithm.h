@@ -0,0 +1,303 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_PARALLEL_ALGORITHM_H_
+#define ABC_PARALLEL_ALGORITHM_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>  // NOLINT
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abc/execution.h"
+#include "abc/thread_pool.h"
+
+// Overloads of some `std` algorithms taking an execution policy, which run
+// `abc::execution::par` on an abc::thread_pool, if the iterators are random
+// access (e.g. those of abc::vector); otherwise, they run the `std` algorithm
+// on the calling thread.
+namespace abc {
+namespace internal {
+
+template <class T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+// The return type `R` of an algorithm taking an execution policy.
+template <class Policy, class R = void>
+using if_policy_t =
+    std::enable_if_t<is_execution_policy_v<remove_cvref_t<Policy>>, R>;
+// Whether an algorithm runs on a pool for `Policy` and all `Its`.
+template <class Policy, class... Its>
+inline constexpr bool is_parallel_v =
+    std::is_base_of_v<execution::parallel_policy, remove_cvref_t<Policy>> &&
+    (std::is_base_of_v<std::random_access_iterator_tag,
+        typename std::iterator_traits<Its>::iterator_category> && ...);
+
+// Split `[0, n)` into chunks, about four per thread of the pool, so that
+// threads that finish early take over the rest.  Ranges shorter than
+// `kMinSize` are not worth waking a thread for, and form a single chunk.
+class chunks {
+ public:
+  static constexpr std::size_t kMinSize = std::size_t(1) << 14;
+
+  chunks(const execution::parallel_policy &policy, std::size_t n)
+      : pool_(policy.pool()), n_(n),
+        size_(std::min((n + kMinSize - 1) / kMinSize,
+                       std::size_t(pool_.size() + 1) * 4)) {}
+  thread_pool &pool() const noexcept { return pool_; }
+  std::size_t size() const noexcept { return size_; }
+  // The first index of the `k`-th chunk, or `n` for `k == size()`.
+  std::size_t begin(std::size_t k) const noexcept { return n_ * k / size_; }
+  // Call `f(k, begin(k), begin(k + 1))` for each chunk in parallel.
+  template <class F>
+  void for_each(F &&f) const {
+    // Each chunk is a task already, so the loop is split down to single ones:
+    pool_.parallel_for(0, size_, [&](std::size_t k) {
+      f(k, begin(k), begin(k + 1));
+    }, 1);
+  }
+
+ private:
+  thread_pool &pool_;
+  std::size_t n_, size_;
+};
+
+// Scan `[first, last)` into `d_first`, starting from `init` if it has a
+// value.  A pass summing each chunk is followed by a pass scanning each chunk
+// from the sum of its predecessors, so `op` must be associative.
+template <class Policy, class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class T>
+ForwardIt2 inclusive_scan(Policy &&policy, ForwardIt1 first, ForwardIt1 last,
+                          ForwardIt2 d_first, BinaryOp op,
+                          std::optional<T> init) {
+  if constexpr (is_parallel_v<Policy, ForwardIt1, ForwardIt2>) {
+    auto n = last - first;
+    auto chunks = internal::chunks(policy, n);
+    if (chunks.size() > 1) {
+      auto sums = std::vector<std::optional<T>>(chunks.size());
+      chunks.for_each([&](std::size_t k, std::size_t i, std::size_t j) {
+        sums[k].emplace(std::accumulate(first + i + 1, first + j,
+                                        T(first[i]), op));
+      });
+      // Replace each sum by the sum of the preceding chunks (and `init`):
+      for (auto &sum : sums) {
+        std::swap(sum, init);
+        if (sum) {
+          init.emplace(op(*sum, *init));
+        }
+      }
+      chunks.for_each([&](std::size_t k, std::size_t i, std::size_t j) {
+        if (sums[k]) {
+          std::inclusive_scan(first + i, first + j, d_first + i, op,
+                              *sums[k]);
+        } else {
+          std::inclusive_scan(first + i, first + j, d_first + i, op);
+        }
+      });
+      return d_first + n;
+    }
+  }
+  if (init) {
+    return std::inclusive_scan(first, last, d_first, op, *init);
+  } else {
+    return std::inclusive_scan(first, last, d_first, op);
+  }
+}
+
+}  // namespace internal
+
+template <class Policy, class ForwardIt, class UnaryFunction>
+internal::if_policy_t<Policy> for_each(Policy &&policy, ForwardIt first,
+                                       ForwardIt last, UnaryFunction f) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt>) {
+    internal::chunks(policy, last - first).for_each(
+        [&](std::size_t, std::size_t i, std::size_t j) {
+          std::for_each(first + i, first + j, f);
+        });
+  } else {
+    std::for_each(first, last, f);
+  }
+}
+
+template <class Policy, class ForwardIt1, class ForwardIt2>
+internal::if_policy_t<Policy, ForwardIt2> copy(Policy &&policy,
+    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt1, ForwardIt2>) {
+    auto n = last - first;
+    internal::chunks(policy, n).for_each(
+        [&](std::size_t, std::size_t i, std::size_t j) {
+          std::copy(first + i, first + j, d_first + i);
+        });
+    return d_first + n;
+  } else {
+    return std::copy(first, last, d_first);
+  }
+}
+
+template <class Policy, class ForwardIt1, class ForwardIt2,
+          class UnaryOperation>
+internal::if_policy_t<Policy, ForwardIt2> transform(Policy &&policy,
+    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+    UnaryOperation op) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt1, ForwardIt2>) {
+    auto n = last - first;
+    internal::chunks(policy, n).for_each(
+        [&](std::size_t, std::size_t i, std::size_t j) {
+          std::transform(first + i, first + j, d_first + i, op);
+        });
+    return d_first + n;
+  } else {
+    return std::transform(first, last, d_first, op);
+  }
+}
+template <class Policy, class ForwardIt1, class ForwardIt2, class ForwardIt3,
+          class BinaryOperation>
+internal::if_policy_t<Policy, ForwardIt3> transform(Policy &&policy,
+    ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2,
+    ForwardIt3 d_first, BinaryOperation op) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt1, ForwardIt2,
+                                        ForwardIt3>) {
+    auto n = last1 - first1;
+    internal::chunks(policy, n).for_each(
+        [&](std::size_t, std::size_t i, std::size_t j) {
+          std::transform(first1 + i, first1 + j, first2 + i, d_first + i, op);
+        });
+    return d_first + n;
+  } else {
+    return std::transform(first1, last1, first2, d_first, op);
+  }
+}
+
+// Each chunk is reduced, then the sums of the chunks are, so `reduce` must
+// be associative and commutative.
+template <class Policy, class ForwardIt, class T, class BinaryReductionOp,
+          class UnaryTransformOp>
+internal::if_policy_t<Policy, T> transform_reduce(Policy &&policy,
+    ForwardIt first, ForwardIt last, T init, BinaryReductionOp reduce,
+    UnaryTransformOp transform) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt>) {
+    auto chunks = internal::chunks(policy, last - first);
+    auto sums = std::vector<std::optional<T>>(chunks.size());
+    chunks.for_each([&](std::size_t k, std::size_t i, std::size_t j) {
+      sums[k].emplace(std::transform_reduce(first + i + 1, first + j,
+          T(transform(first[i])), reduce, transform));
+    });
+    for (auto &sum : sums) {
+      init = reduce(std::move(init), std::move(*sum));
+    }
+    return init;
+  } else {
+    return std::transform_reduce(first, last, std::move(init), reduce,
+                                 transform);
+  }
+}
+template <class Policy, class ForwardIt1, class ForwardIt2, class T,
+          class BinaryReductionOp, class BinaryTransformOp>
+internal::if_policy_t<Policy, T> transform_reduce(Policy &&policy,
+    ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init,
+    BinaryReductionOp reduce, BinaryTransformOp transform) {
+  if constexpr (internal::is_parallel_v<Policy, ForwardIt1, ForwardIt2>) {
+    auto chunks = internal::chunks(policy, last1 - first1);
+    auto sums = std::vector<std::optional<T>>(chunks.size());
+    chunks.for_each([&](std::size_t k, std::size_t i, std::size_t j) {
+      sums[k].emplace(std::transform_reduce(first1 + i + 1, first1 + j,
+          first2 + i + 1, T(transform(first1[i], first2[i])), reduce,
+          transform));
+    });
+    for (auto &sum : sums) {
+      init = reduce(std::move(init), std::move(*sum));
+    }
+    return init;
+  } else {
+    return std::transform_reduce(first1, last1, first2, std::move(init),
+                                 reduce, transform);
+  }
+}
+template <class Policy, class ForwardIt1, class ForwardIt2, class T>
+internal::if_policy_t<Policy, T> transform_reduce(Policy &&policy,
+    ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init) {
+  return abc::transform_reduce(std::forward<Policy>(policy), first1, last1,
+                               first2, std::move(init), std::plus<>(),
+                               std::multiplies<>());
+}
+
+template <class Policy, class ForwardIt, class T, class BinaryOp>
+internal::if_policy_t<Policy, T> reduce(Policy &&policy,
+    ForwardIt first, ForwardIt last, T init, BinaryOp op) {
+  return abc::transform_reduce(std::forward<Policy>(policy), first, last,
+                               std::move(init), op,
+                               [](const auto &x) -> const auto & { return x; });
+}
+template <class Policy, class ForwardIt, class T>
+internal::if_policy_t<Policy, T> reduce(Policy &&policy,
+    ForwardIt first, ForwardIt last, T init) {
+  return abc::reduce(std::forward<Policy>(policy), first, last,
+                     std::move(init), std::plus<>());
+}
+template <class Policy, class ForwardIt>
+internal::if_policy_t<Policy,
+                      typename std::iterator_traits<ForwardIt>::value_type>
+reduce(Policy &&policy, ForwardIt first, ForwardIt last) {
+  using T = typename std::iterator_traits<ForwardIt>::value_type;
+  return abc::reduce(std::forward<Policy>(policy), first, last, T());
+}
+
+template <class Policy, class ForwardIt1, class ForwardIt2, class BinaryOp,
+          class T>
+internal::if_policy_t<Policy, ForwardIt2> inclusive_scan(Policy &&policy,
+    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOp op,
+    T init) {
+  return internal::inclusive_scan(std::forward<Policy>(policy), first, last,
+                                  d_first, op, std::optional<T>(init));
+}
+template <class Policy, class ForwardIt1, class ForwardIt2, class BinaryOp>
+internal::if_policy_t<Policy, ForwardIt2> inclusive_scan(Policy &&policy,
+    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOp op) {
+  using T = typename std::iterator_traits<ForwardIt1>::value_type;
+  return internal::inclusive_scan(std::forward<Policy>(policy), first, last,
+                                  d_first, op, std::optional<T>());
+}
+template <class Policy, class ForwardIt1, class ForwardIt2>
+internal::if_policy_t<Policy, ForwardIt2> inclusive_scan(Policy &&policy,
+    ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first) {
+  return abc::inclusive_scan(std::forward<Policy>(policy), first, last,
+                             d_first, std::plus<>());
+}
+
+// The chunks are sorted in parallel, then merged pairwise in rounds.
+template <class Policy, class RandomIt, class Compare>
+internal::if_policy_t<Policy> sort(Policy &&policy, RandomIt first,
+                                   RandomIt last, Compare comp) {
+  if constexpr (internal::is_parallel_v<Policy, RandomIt>) {
+    auto chunks = internal::chunks(policy, last - first);
+    chunks.for_each([&](std::size_t, std::size_t i, std::size_t j) {
+      std::sort(first + i, first + j, comp);
+    });
+    auto n = chunks.size();
+    for (std::size_t width = 1; width < n; width *= 2) {
+      chunks.pool().parallel_for(0, (n + 2 * width - 1) / (2 * width),
+          [&](std::size_t pair) {
+            auto lo = 2 * width * pair, mid = lo + width;
+            if (mid < n) {
+              auto hi = std::min(mid + width, n);
+              std::inplace_merge(first + chunks.begin(lo),
+                                 first + chunks.begin(mid),
+                                 first + chunks.begin(hi), comp);
+            }
+          }, 1);
+    }
+  } else {
+    std::sort(first, last, comp);
+  }
+}
+template <class Policy, class RandomIt>
+internal::if_policy_t<Policy> sort(Policy &&policy, RandomIt first,
+                                   RandomIt last) {
+  abc::sort(std::forward<Policy>(policy), first, last, std::less<>());
+}
+
+}  // namespace abc
+
+#endif  // ABC_PARALLEL_ALGORITHM_H_
@@ -0,0 +1,360 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SERIALIZE_H_
+#define ABC_SERIALIZE_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "abc/forward_list.h"
+#include "abc/utility.h"
+#include "abc/vector.h"
+
+// A length-prefixed binary format for abc containers.
+//
+// A container is written as its number of elements (a `std::uint64_t`)
+// followed by its elements, each written by abc::serializer, so containers
+// nest.  An element of a trivially copyable type is written as its bytes, and
+// an array of them (e.g. in an abc::vector) by a single `write`.  Numbers are
+// in the byte order of the machine, so a file moves only between machines of
+// the same order.
+//
+// A sink is any type with `void write(const void *data, std::size_t bytes)`,
+// and a source is any type with `void read(void *data, std::size_t bytes)`,
+// which reads exactly `bytes` bytes or throws.  Buffers and file descriptors
+// are supported by the classes below.
+namespace abc {
+
+// Write the bytes into a growing abc::vector<char>.
+class buffer_sink {
+ public:
+  void write(const void *data, std::size_t bytes) {
+    auto old_size = bytes_.size();
+    bytes_.resize(old_size + bytes);
+    std::memcpy(bytes_.data() + old_size, data, bytes);
+  }
+  const abc::vector<char> &bytes() const noexcept { return bytes_; }
+  void clear() noexcept { bytes_.clear(); }
+
+ private:
+  abc::vector<char> bytes_;
+};
+
+// Read the bytes from a buffer owned by others.
+class buffer_source {
+ public:
+  buffer_source(const void *data, std::size_t bytes) noexcept
+      : next_(static_cast<const char *>(data)), end_(next_ + bytes) {}
+  explicit buffer_source(const abc::vector<char> &bytes) noexcept
+      : buffer_source(bytes.data(), bytes.size()) {}
+
+  void read(void *data, std::size_t bytes) {
+    if (bytes > remaining()) {
+      throw std::runtime_error("Unexpected end of input!");
+    }
+    std::memcpy(data, next_, bytes);
+    next_ += bytes;
+  }
+  std::size_t remaining() const noexcept { return end_ - next_; }
+
+ private:
+  const char *next_, *end_;
+};
+
+// Write the bytes into a file descriptor (a file, a pipe or a socket).
+//
+// Small writes, e.g. length prefixes and the elements of a list, are gathered
+// in a buffer.  A write that does not fit is sent together with the buffered
+// bytes by one `writev`, without being copied.  The buffered bytes are sent
+// by `flush()`, or by the destructor, which ignores errors.
+class fd_sink {
+ public:
+  static constexpr std::size_t kBufferBytes = std::size_t(1) << 16;
+
+  explicit fd_sink(int fd, std::size_t buffer_bytes = kBufferBytes)
+      : buffer_(new char[buffer_bytes]), capacity_(buffer_bytes), fd_(fd) {}
+  fd_sink(const fd_sink &) = delete;
+  fd_sink &operator=(const fd_sink &) = delete;
+  ~fd_sink() noexcept {
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  void write(const void *data, std::size_t bytes) {
+    if (bytes <= capacity_ && used_ <= capacity_ - bytes) {
+      std::memcpy(buffer_.get() + used_, data, bytes);
+      used_ += bytes;
+      return;
+    }
+    iovec chunks[2] = {{buffer_.get(), used_},
+                       {const_cast<void *>(data), bytes}};
+    used_ = 0;
+    write_all(chunks, 2);
+  }
+  void flush() {
+    iovec chunk = {buffer_.get(), used_};
+    used_ = 0;
+    write_all(&chunk, 1);
+  }
+
+ private:
+  void write_all(iovec *chunks, int count) {
+    while (count) {
+      auto written = ::writev(fd_, chunks, count);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        internal::throw_errno("writev");
+      }
+      // Skip the chunks written, and the written part of the next one:
+      auto n = static_cast<std::size_t>(written);
+      for (; count && n >= chunks->iov_len; ++chunks, --count) {
+        n -= chunks->iov_len;
+      }
+      if (count) {
+        chunks->iov_base = static_cast<char *>(chunks->iov_base) + n;
+        chunks->iov_len -= n;
+      }
+    }
+  }
+
+  std::unique_ptr<char[]> buffer_;
+  std::size_t capacity_, used_{0};
+  int fd_;
+};
+
+// Read the bytes from a file descriptor.
+//
+// Small reads are served from a buffer, which is refilled by one `read`.  A
+// read larger than the buffer goes straight into its destination.
+class fd_source {
+ public:
+  static constexpr std::size_t kBufferBytes = std::size_t(1) << 16;
+
+  explicit fd_source(int fd, std::size_t buffer_bytes = kBufferBytes)
+      : buffer_(new char[buffer_bytes]), capacity_(buffer_bytes), fd_(fd) {}
+  fd_source(const fd_source &) = delete;
+  fd_source &operator=(const fd_source &) = delete;
+
+  void read(void *data, std::size_t bytes) {
+    auto out = static_cast<char *>(data);
+    auto n = std::min(bytes, end_ - next_);
+    std::memcpy(out, buffer_.get() + next_, n);
+    next_ += n;
+    out += n;
+    bytes -= n;
+    if (bytes == 0) {
+      return;
+    }
+    if (bytes >= capacity_) {
+      read_at_least(out, bytes, bytes);
+      return;
+    }
+    end_ = read_at_least(buffer_.get(), bytes, capacity_);
+    std::memcpy(out, buffer_.get(), bytes);
+    next_ = bytes;
+  }
+
+ private:
+  // Read `min_bytes` to `max_bytes` bytes into `out`, and return how many.
+  std::size_t read_at_least(char *out, std::size_t min_bytes,
+                            std::size_t max_bytes) {
+    std::size_t total = 0;
+    while (total < min_bytes) {
+      auto n = ::read(fd_, out + total, max_bytes - total);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        internal::throw_errno("read");
+      }
+      if (n == 0) {
+        throw std::runtime_error("Unexpected end of input!");
+      }
+      total += n;
+    }
+    return total;
+  }
+
+  std::unique_ptr<char[]> buffer_;
+  std::size_t capacity_, next_{0}, end_{0};
+  int fd_;
+};
+
+// Write and read a `T` by `write(Sink &, const T &)` and
+// `read(Source &, T &)`.  Specialize it to support other types.
+template <class T, class = void>
+struct serializer;
+
+template <class T>
+struct serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+  // An array of `T`s is written and read in bulk.
+  using is_bitwise = std::true_type;
+
+  template <class Sink>
+  static void write(Sink &sink, const T &value) {
+    sink.write(&value, sizeof(T));
+  }
+  template <class Source>
+  static void read(Source &source, T &value) {
+    source.read(&value, sizeof(T));
+  }
+};
+
+namespace internal {
+
+// Whether a `T` is written as its bytes, so an array of `T`s is written in
+// bulk.  It is false for a user's serializer without `is_bitwise`.
+template <class T, class = void>
+struct is_bitwise_serialized : std::false_type {};
+template <class T>
+struct is_bitwise_serialized<T, std::void_t<
+    typename serializer<T>::is_bitwise>> : serializer<T>::is_bitwise {};
+template <class T>
+inline constexpr bool is_bitwise_serialized_v =
+    is_bitwise_serialized<T>::value;
+
+template <class Sink>
+void write_size(Sink &sink, std::size_t size) {
+  auto n = static_cast<std::uint64_t>(size);
+  sink.write(&n, sizeof(n));
+}
+template <class Source>
+std::size_t read_size(Source &source) {
+  std::uint64_t n;
+  source.read(&n, sizeof(n));
+  return static_cast<std::size_t>(n);
+}
+
+}  // namespace internal
+
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+struct serializer<abc::vector<T, Allocator, GrowthPolicy, N>> {
+  using vector = abc::vector<T, Allocator, GrowthPolicy, N>;
+  // The most bytes read into a vector before it grows again, unless it has
+  // already reserved room for all of its elements.
+  static constexpr std::size_t kChunkBytes = std::size_t(1) << 20;
+
+  template <class Sink>
+  static void write(Sink &sink, const vector &value) {
+    internal::write_size(sink, value.size());
+    if constexpr (internal::is_bitwise_serialized_v<T>) {
+      sink.write(value.data(), value.size() * sizeof(T));
+    } else {
+      for (auto &element : value) {
+        serializer<T>::write(sink, element);
+      }
+    }
+  }
+  // Replace the elements of `value` by those read.  The vector grows only
+  // as the elements arrive, so a corrupt length cannot exhaust the memory.
+  template <class Source>
+  static void read(Source &source, vector &value) {
+    auto n = internal::read_size(source);
+    value.clear();
+    if constexpr (internal::is_bitwise_serialized_v<T>) {
+      auto step = n <= value.capacity() ? n : kChunkBytes / sizeof(T) + 1;
+      while (value.size() != n) {
+        // The bytes are read into the room past `size()`, not over zeros:
+        auto old_size = value.size();
+        value.resize_and_overwrite(old_size + std::min(step, n - old_size),
+            [&](T *data, std::size_t count) {
+              source.read(data + old_size, (count - old_size) * sizeof(T));
+              return count;
+            });
+      }
+    } else {
+      for (std::size_t i = 0; i != n; ++i) {
+        serializer<T>::read(source, value.emplace_back());
+      }
+    }
+  }
+};
+
+template <class T, class Allocator>
+struct serializer<abc::forward_list<T, Allocator>> {
+  using list = abc::forward_list<T, Allocator>;
+  // Elements written as bytes are gathered in batches of this many bytes,
+  // so a sink or a source is called once per batch instead of per element.
+  static constexpr std::size_t kBatchBytes = 4096;
+  static constexpr std::size_t kBatch = std::max<std::size_t>(
+      1, kBatchBytes / sizeof(T));
+
+  template <class Sink>
+  static void write(Sink &sink, const list &value) {
+    internal::write_size(sink, std::distance(value.begin(), value.end()));
+    if constexpr (internal::is_bitwise_serialized_v<T>) {
+      alignas(T) char batch[kBatch * sizeof(T)];
+      std::size_t count = 0;
+      for (auto &element : value) {
+        std::memcpy(batch + count * sizeof(T), &element, sizeof(T));
+        if (++count == kBatch) {
+          sink.write(batch, sizeof(batch));
+          count = 0;
+        }
+      }
+      sink.write(batch, count * sizeof(T));
+    } else {
+      for (auto &element : value) {
+        serializer<T>::write(sink, element);
+      }
+    }
+  }
+  // Replace the elements of `value` by those read, in the same order.
+  template <class Source>
+  static void read(Source &source, list &value) {
+    auto n = internal::read_size(source);
+    value.clear();
+    auto tail = value.before_begin();
+    if constexpr (internal::is_bitwise_serialized_v<T>) {
+      alignas(T) char batch[kBatch * sizeof(T)];
+      auto elements = reinterpret_cast<const T *>(batch);
+      for (std::size_t i = 0; i != n;) {
+        auto count = std::min(kBatch, n - i);
+        source.read(batch, count * sizeof(T));
+        for (std::size_t j = 0; j != count; ++j) {
+          tail = value.emplace_after(tail, elements[j]);
+        }
+        i += count;
+      }
+    } else {
+      for (std::size_t i = 0; i != n; ++i) {
+        tail = value.emplace_after(tail);
+        serializer<T>::read(source, *tail);
+      }
+    }
+  }
+};
+
+// Write `value` into `sink`.
+template <class Sink, class T>
+void serialize(Sink &sink, const T &value) {
+  serializer<T>::write(sink, value);
+}
+// Read `value` from `source`, reusing its memory if possible.
+template <class Source, class T>
+void deserialize(Source &source, T &value) {
+  serializer<T>::read(source, value);
+}
+template <class T, class Source>
+T deserialize(Source &source) {
+  T value;
+  serializer<T>::read(source, value);
+  return value;
+}
+
+}  // namespace abc
+
+#endif  // ABC_SERIALIZE_H_
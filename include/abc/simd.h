@@ -0,0 +1,402 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SIMD_H_
+#define ABC_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+// Compile a function for AVX2, whatever `-march` is.  Such a function must
+// only be called after `abc::simd::has_avx2()` returns true.
+#define ABC_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+
+// Kernels that search and compare arrays of integers or floating-point
+// numbers, or count the set bits of an array of words, a register at a time.
+// On x86-64, SSE2 is always available and AVX2 is picked at runtime if the
+// CPU supports it; elsewhere, plain loops are left to the auto-vectorizer.
+namespace abc {
+namespace simd {
+
+// Whether the kernels accept elements of type `T`.
+template <class T>
+inline constexpr bool is_vectorizable_v =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+namespace scalar {
+
+template <class T>
+const T *find(const T *first, const T *last, T value) noexcept {
+  while (first != last && !(*first == value)) {
+    ++first;
+  }
+  return first;
+}
+template <class T>
+std::size_t count(const T *first, const T *last, T value) noexcept {
+  std::size_t n = 0;
+  for (; first != last; ++first) {
+    n += (*first == value);
+  }
+  return n;
+}
+// Return the index of the first `i` in `[0, n)` that `!(a[i] == b[i])`.
+template <class T>
+std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept {
+  std::size_t i = 0;
+  while (i != n && a[i] == b[i]) {
+    ++i;
+  }
+  return i;
+}
+
+// Return the mask whose bit `i` is set if `p[i] == b`, for `i` in [0, 16).
+inline unsigned match_byte(const std::int8_t *p, std::int8_t b) noexcept {
+  unsigned m = 0;
+  for (int i = 0; i != 16; ++i) {
+    m |= unsigned(p[i] == b) << i;
+  }
+  return m;
+}
+// Return the mask whose bit `i` is set if `p[i] < 0`, for `i` in [0, 16).
+inline unsigned match_sign(const std::int8_t *p) noexcept {
+  unsigned m = 0;
+  for (int i = 0; i != 16; ++i) {
+    m |= unsigned(p[i] < 0) << i;
+  }
+  return m;
+}
+
+// Return the number of set bits in `words[0, n)`.
+inline std::size_t popcount(const std::uint64_t *words,
+                            std::size_t n) noexcept {
+  std::size_t bits = 0;
+  for (std::size_t i = 0; i != n; ++i) {
+    bits += __builtin_popcountll(words[i]);
+  }
+  return bits;
+}
+
+}  // namespace scalar
+
+#ifdef ABC_SIMD_X86
+
+inline bool has_avx2() noexcept {
+  static const bool kHasAvx2 = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+  }();
+  return kHasAvx2;
+}
+
+// In both namespaces below, `equal<T>(a, b)` sets all bits of the lanes in
+// which `a` and `b` hold equal `T`s, so that the mask of bytes has
+// `sizeof(T)` bits per equal element.
+namespace sse2 {
+
+constexpr std::size_t kBytes = 16;
+constexpr unsigned kFullMask = 0xFFFF;
+
+inline __m128i load(const void *p) noexcept {
+  return _mm_loadu_si128(static_cast<const __m128i *>(p));
+}
+inline unsigned mask(__m128i lanes) noexcept {
+  return static_cast<unsigned>(_mm_movemask_epi8(lanes));
+}
+template <class T>
+__m128i broadcast(T value) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_set1_ps(value));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_set1_pd(value));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_set1_epi16(static_cast<int16_t>(value));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_set1_epi32(static_cast<int32_t>(value));
+  } else {
+    return _mm_set1_epi64x(static_cast<int64_t>(value));
+  }
+}
+template <class T>
+__m128i equal(__m128i a, __m128i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a),
+                                         _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a),
+                                         _mm_castsi128_pd(b)));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_cmpeq_epi32(a, b);
+  } else {  // SSE2 has no `_mm_cmpeq_epi64`, so both halves must be equal:
+    auto halves = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(halves,
+                         _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+}
+
+template <class T>
+const T *find(const T *first, const T *last, T value) noexcept {
+  constexpr std::ptrdiff_t kStep = kBytes / sizeof(T);
+  auto lanes = broadcast(value);
+  for (; last - first >= kStep; first += kStep) {
+    if (auto m = mask(equal<T>(load(first), lanes))) {
+      return first + __builtin_ctz(m) / sizeof(T);
+    }
+  }
+  return scalar::find(first, last, value);
+}
+template <class T>
+std::size_t count(const T *first, const T *last, T value) noexcept {
+  constexpr std::ptrdiff_t kStep = kBytes / sizeof(T);
+  auto lanes = broadcast(value);
+  std::size_t bits = 0;
+  for (; last - first >= kStep; first += kStep) {
+    bits += __builtin_popcount(mask(equal<T>(load(first), lanes)));
+  }
+  return bits / sizeof(T) + scalar::count(first, last, value);
+}
+template <class T>
+std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept {
+  constexpr std::size_t kStep = kBytes / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if (auto m = mask(equal<T>(load(a + i), load(b + i))) ^ kFullMask) {
+      return i + __builtin_ctz(m) / sizeof(T);
+    }
+  }
+  return i + scalar::mismatch(a + i, b + i, n - i);
+}
+
+inline unsigned match_byte(const std::int8_t *p, std::int8_t b) noexcept {
+  return mask(_mm_cmpeq_epi8(load(p), _mm_set1_epi8(b)));
+}
+inline unsigned match_sign(const std::int8_t *p) noexcept {
+  return mask(load(p));
+}
+
+// SSE2 has no `popcnt`, so count the bits of each byte by halving (as in
+// "Hacker's Delight"), then sum the bytes by `_mm_sad_epu8`.
+inline std::size_t popcount(const std::uint64_t *words,
+                            std::size_t n) noexcept {
+  const auto m1 = _mm_set1_epi8(0x55);
+  const auto m2 = _mm_set1_epi8(0x33);
+  const auto m4 = _mm_set1_epi8(0x0F);
+  auto sums = _mm_setzero_si128();
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    auto x = load(words + i);
+    x = _mm_sub_epi8(x, _mm_and_si128(_mm_srli_epi64(x, 1), m1));
+    x = _mm_add_epi8(_mm_and_si128(x, m2),
+                     _mm_and_si128(_mm_srli_epi64(x, 2), m2));
+    x = _mm_and_si128(_mm_add_epi8(x, _mm_srli_epi64(x, 4)), m4);
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(x, _mm_setzero_si128()));
+  }
+  auto bits = static_cast<std::size_t>(_mm_cvtsi128_si64(sums)) +
+      static_cast<std::size_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums,
+                                                                    sums)));
+  return bits + scalar::popcount(words + i, n - i);
+}
+
+}  // namespace sse2
+
+namespace avx2 {
+
+constexpr std::size_t kBytes = 32;
+constexpr unsigned kFullMask = 0xFFFFFFFF;
+
+ABC_TARGET_AVX2 inline __m256i load(const void *p) noexcept {
+  return _mm256_loadu_si256(static_cast<const __m256i *>(p));
+}
+ABC_TARGET_AVX2 inline unsigned mask(__m256i lanes) noexcept {
+  return static_cast<unsigned>(_mm256_movemask_epi8(lanes));
+}
+template <class T>
+ABC_TARGET_AVX2 __m256i broadcast(T value) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_set1_ps(value));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_set1_pd(value));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_set1_epi16(static_cast<int16_t>(value));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(static_cast<int32_t>(value));
+  } else {
+    return _mm256_set1_epi64x(static_cast<int64_t>(value));
+  }
+}
+template <class T>
+ABC_TARGET_AVX2 __m256i equal(__m256i a, __m256i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_cmp_ps(
+        _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_cmp_pd(
+        _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_cmpeq_epi32(a, b);
+  } else {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+}
+
+template <class T>
+ABC_TARGET_AVX2 const T *find(const T *first, const T *last, T value) noexcept {
+  constexpr std::ptrdiff_t kStep = kBytes / sizeof(T);
+  auto lanes = broadcast(value);
+  for (; last - first >= kStep; first += kStep) {
+    if (auto m = mask(equal<T>(load(first), lanes))) {
+      return first + __builtin_ctz(m) / sizeof(T);
+    }
+  }
+  return sse2::find(first, last, value);
+}
+template <class T>
+ABC_TARGET_AVX2 std::size_t count(const T *first, const T *last,
+                                  T value) noexcept {
+  constexpr std::ptrdiff_t kStep = kBytes / sizeof(T);
+  auto lanes = broadcast(value);
+  std::size_t bits = 0;
+  for (; last - first >= kStep; first += kStep) {
+    bits += __builtin_popcount(mask(equal<T>(load(first), lanes)));
+  }
+  return bits / sizeof(T) + sse2::count(first, last, value);
+}
+template <class T>
+ABC_TARGET_AVX2 std::size_t mismatch(const T *a, const T *b,
+                                     std::size_t n) noexcept {
+  constexpr std::size_t kStep = kBytes / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if (auto m = mask(equal<T>(load(a + i), load(b + i))) ^ kFullMask) {
+      return i + __builtin_ctz(m) / sizeof(T);
+    }
+  }
+  return i + sse2::mismatch(a + i, b + i, n - i);
+}
+
+// Look up the bits of each nibble in a table of 16 bytes by `vpshufb` (as in
+// Mula, Kurz and Lemire, "Faster Population Counts Using AVX2 Instructions"),
+// add up to 8 registers of byte counts, then sum the bytes by `vpsadbw`.
+ABC_TARGET_AVX2 inline std::size_t popcount(const std::uint64_t *words,
+                                            std::size_t n) noexcept {
+  const auto table = _mm256_setr_epi8(
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const auto low = _mm256_set1_epi8(0x0F);
+  constexpr std::size_t kStep = kBytes / sizeof(std::uint64_t);
+  auto sums = _mm256_setzero_si256();
+  std::size_t i = 0;
+  while (i + kStep <= n) {
+    // Each byte of `bytes` grows by at most 8 per register, so 8 fit in it.
+    auto bytes = _mm256_setzero_si256();
+    for (int k = 0; k != 8 && i + kStep <= n; ++k, i += kStep) {
+      auto x = load(words + i);
+      auto lo = _mm256_shuffle_epi8(table, _mm256_and_si256(x, low));
+      auto hi = _mm256_shuffle_epi8(
+          table, _mm256_and_si256(_mm256_srli_epi16(x, 4), low));
+      bytes = _mm256_add_epi8(bytes, _mm256_add_epi8(lo, hi));
+    }
+    sums = _mm256_add_epi64(sums,
+                            _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+  }
+  alignas(32) std::uint64_t lanes[kStep];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), sums);
+  std::size_t bits = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  for (; i != n; ++i) {
+    bits += _mm_popcnt_u64(words[i]);
+  }
+  return bits;
+}
+
+}  // namespace avx2
+
+#endif  // ABC_SIMD_X86
+
+// The dispatchers, which pick the widest kernel supported by the CPU.
+template <class T>
+const T *find(const T *first, const T *last, T value) noexcept {
+  static_assert(is_vectorizable_v<T>);
+#ifdef ABC_SIMD_X86
+  if (has_avx2()) {
+    return avx2::find(first, last, value);
+  }
+  return sse2::find(first, last, value);
+#else
+  return scalar::find(first, last, value);
+#endif
+}
+template <class T>
+std::size_t count(const T *first, const T *last, T value) noexcept {
+  static_assert(is_vectorizable_v<T>);
+#ifdef ABC_SIMD_X86
+  if (has_avx2()) {
+    return avx2::count(first, last, value);
+  }
+  return sse2::count(first, last, value);
+#else
+  return scalar::count(first, last, value);
+#endif
+}
+template <class T>
+std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept {
+  static_assert(is_vectorizable_v<T>);
+#ifdef ABC_SIMD_X86
+  if (has_avx2()) {
+    return avx2::mismatch(a, b, n);
+  }
+  return sse2::mismatch(a, b, n);
+#else
+  return scalar::mismatch(a, b, n);
+#endif
+}
+
+inline std::size_t popcount(const std::uint64_t *words,
+                            std::size_t n) noexcept {
+#ifdef ABC_SIMD_X86
+  if (has_avx2()) {
+    return avx2::popcount(words, n);
+  }
+  return sse2::popcount(words, n);
+#else
+  return scalar::popcount(words, n);
+#endif
+}
+
+// Match a group of 16 bytes (e.g. the control bytes of a hash table) at once.
+// SSE2 does it in a single compare, so AVX2 is not worth dispatching to.
+inline constexpr std::size_t kGroupBytes = 16;
+inline unsigned match_byte(const std::int8_t *p, std::int8_t b) noexcept {
+#ifdef ABC_SIMD_X86
+  return sse2::match_byte(p, b);
+#else
+  return scalar::match_byte(p, b);
+#endif
+}
+inline unsigned match_sign(const std::int8_t *p) noexcept {
+#ifdef ABC_SIMD_X86
+  return sse2::match_sign(p);
+#else
+  return scalar::match_sign(p);
+#endif
+}
+
+}  // namespace simd
+}  // namespace abc
+
+#endif  // ABC_SIMD_H_
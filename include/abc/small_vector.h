@@ -0,0 +1,21 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SMALL_VECTOR_H_
+#define ABC_SMALL_VECTOR_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "abc/vector.h"
+
+namespace abc {
+
+// An abc::vector storing up to `N` elements inside itself, and spilling to
+// memory from `Allocator` beyond that.  Moving an inline small_vector moves
+// its elements (by `std::memcpy` if they are trivially relocatable).
+template <class T, std::size_t N, class Allocator = std::allocator<T>,
+          class GrowthPolicy = abc::growth_policy<>>
+using small_vector = abc::vector<T, Allocator, GrowthPolicy, N>;
+
+}  // namespace abc
+
+#endif  // ABC_SMALL_VECTOR_H_
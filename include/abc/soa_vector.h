@@ -0,0 +1,511 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SOA_VECTOR_H_
+#define ABC_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/span.h"
+#include "abc/stats.h"
+#include "abc/type_traits.h"
+#include "abc/vector.h"
+
+namespace abc {
+
+// A vector of rows whose fields (of types `Ts...`) are stored column by
+// column (structure of arrays), so a loop over a few fields only loads those
+// fields, and loads them contiguously, which suits SIMD.
+//
+// All columns share one size and one capacity, and live in a single block,
+// each starting on its own cache line.  `column<I>()` returns the `I`-th
+// column as an abc::span.  A row is reached by `operator[]` or an iterator,
+// which yield a `std::tuple` of references, e.g.
+//
+//   auto v = abc::soa_vector<int, double>();
+//   v.emplace_back(1, 0.5);
+//   auto [id, weight] = v[0];  // references to the fields of row 0
+//   for (auto &w : v.column<1>()) { w *= 2; }
+template <class... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "A row needs at least one field.");
+  static_assert((std::is_nothrow_move_constructible_v<Ts> && ...),
+                "Relocating the columns must not be left halfway by a throw.");
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using growth_policy_type = abc::growth_policy<>;
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+  static constexpr std::size_t kColumns = sizeof...(Ts);
+  static constexpr std::size_t kAlignment =
+      std::max({std::size_t(64), alignof(Ts)...});
+
+ private:
+  using indices = std::index_sequence_for<Ts...>;
+  using pointers = std::tuple<Ts *...>;
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<soa_vector>(s, n);
+  }
+
+  size_type size_{0};
+  size_type capacity_{0};
+  void *block_{nullptr};
+  pointers columns_{};
+
+  template <std::size_t... Is>
+  static reference row(const pointers &columns, size_type i,
+                       std::index_sequence<Is...>) noexcept {
+    return reference(std::get<Is>(columns)[i]...);
+  }
+  template <std::size_t... Is>
+  static const_reference const_row(const pointers &columns, size_type i,
+                                   std::index_sequence<Is...>) noexcept {
+    return const_reference(std::get<Is>(columns)[i]...);
+  }
+
+ public:
+  template <bool kConst>
+  class basic_iterator {
+    friend class soa_vector;
+    template <bool> friend class basic_iterator;
+    pointers columns_{};
+    std::ptrdiff_t i_{0};
+
+    basic_iterator(const pointers &columns, std::ptrdiff_t i) noexcept
+        : columns_(columns), i_(i) {}
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename soa_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<kConst, const_reference,
+                                         typename soa_vector::reference>;
+    // `iter->` is reached through a proxy holding `*iter`.
+    struct pointer {
+      reference ref;
+      const reference *operator->() const noexcept { return &ref; }
+    };
+
+    basic_iterator() noexcept = default;
+    template <bool kOtherConst,
+              class = std::enable_if_t<kConst && !kOtherConst>>
+    basic_iterator(const basic_iterator<kOtherConst> &that) noexcept  // NOLINT
+        : columns_(that.columns_), i_(that.i_) {}
+
+    reference operator*() const noexcept { return (*this)[0]; }
+    pointer operator->() const noexcept { return {**this}; }
+    reference operator[](difference_type n) const noexcept {
+      if constexpr (kConst) {
+        return const_row(columns_, i_ + n, indices{});
+      } else {
+        return row(columns_, i_ + n, indices{});
+      }
+    }
+    basic_iterator &operator++() noexcept { return *this += 1; }
+    basic_iterator operator++(int) noexcept {
+      auto old = *this;
+      *this += 1;
+      return old;
+    }
+    basic_iterator &operator--() noexcept { return *this -= 1; }
+    basic_iterator operator--(int) noexcept {
+      auto old = *this;
+      *this -= 1;
+      return old;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      i_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      i_ -= n;
+      return *this;
+    }
+    friend basic_iterator operator+(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator+(difference_type n,
+                                    basic_iterator iter) noexcept {
+      return iter += n;
+    }
+    friend basic_iterator operator-(basic_iterator iter,
+                                    difference_type n) noexcept {
+      return iter -= n;
+    }
+    friend difference_type operator-(const basic_iterator &lhs,
+                                     const basic_iterator &rhs) noexcept {
+      return lhs.i_ - rhs.i_;
+    }
+    friend bool operator==(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.i_ == rhs.i_;
+    }
+    friend bool operator!=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return lhs.i_ != rhs.i_;
+    }
+    friend bool operator<(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return lhs.i_ < rhs.i_;
+    }
+    friend bool operator>(const basic_iterator &lhs,
+                          const basic_iterator &rhs) noexcept {
+      return rhs < lhs;
+    }
+    friend bool operator<=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(rhs < lhs);
+    }
+    friend bool operator>=(const basic_iterator &lhs,
+                           const basic_iterator &rhs) noexcept {
+      return !(lhs < rhs);
+    }
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  // construction
+  soa_vector() = default;
+  // A constructor that throws still destroys the rows made so far, since the
+  // object is complete once the delegated constructor returns.
+  explicit soa_vector(size_type count) : soa_vector() { resize(count); }
+  soa_vector(std::initializer_list<value_type> init) : soa_vector() {
+    reserve(init.size());
+    for (auto &value : init) {
+      push_back(value);
+    }
+  }
+  // destruction
+  ~soa_vector() noexcept {
+    clear();
+    deallocate(block_);
+  }
+  // copy operations
+  soa_vector(const soa_vector &that) : soa_vector() {
+    reserve(that.size());
+    for (size_type i = 0; i != that.size(); ++i) {
+      std::apply([this](const Ts &...fields) { emplace_back(fields...); },
+                 that[i]);
+    }
+  }
+  soa_vector &operator=(const soa_vector &that) {
+    if (this != &that) {
+      auto copy = that;
+      swap(copy);
+    }
+    return *this;
+  }
+  // move operations
+  soa_vector(soa_vector &&that) noexcept { swap(that); }
+  soa_vector &operator=(soa_vector &&that) noexcept {
+    if (this != &that) {
+      auto old = soa_vector(abc::move(*this));
+      swap(that);
+    }
+    return *this;
+  }
+  void swap(soa_vector &that) noexcept {
+    std::swap(size_, that.size_);
+    std::swap(capacity_, that.capacity_);
+    std::swap(block_, that.block_);
+    std::swap(columns_, that.columns_);
+  }
+
+  // iterators
+  iterator begin() noexcept { return {columns_, 0}; }
+  iterator end() noexcept { return {columns_, difference_type(size_)}; }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return {columns_, 0}; }
+  const_iterator cend() const noexcept {
+    return {columns_, difference_type(size_)};
+  }
+
+  // non-modifying methods
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  // column accessors
+  template <std::size_t I>
+  column_type<I> *data() noexcept { return std::get<I>(columns_); }
+  template <std::size_t I>
+  const column_type<I> *data() const noexcept {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  abc::span<column_type<I>> column() noexcept {
+    return {data<I>(), size_};
+  }
+  template <std::size_t I>
+  abc::span<const column_type<I>> column() const noexcept {
+    return {data<I>(), size_};
+  }
+  // row accessors (without check)
+  reference operator[](size_type pos) noexcept {
+    return row(columns_, pos, indices{});
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    return const_row(columns_, pos, indices{});
+  }
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size_ - 1]; }
+  const_reference back() const noexcept { return (*this)[size_ - 1]; }
+  // row accessors (with check)
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return (*this)[pos];
+  }
+
+  // capacity methods
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      reallocate(new_capacity, [](const pointers &) {});
+    }
+  }
+  void shrink_to_fit() {
+    if (capacity_ > size_) {
+      reallocate(size_, [](const pointers &) {});
+    }
+  }
+
+  // modifying methods
+  // Append a row whose `I`-th field is constructed from the `I`-th argument.
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == kColumns,
+                  "Give one argument for each field.");
+    auto fields = std::forward_as_tuple(std::forward<Args>(args)...);
+    if (size_ == capacity_) {
+      // The arguments might refer to a row, so construct before relocating:
+      reallocate(growth_policy_type::grow(size_, size_ + 1),
+                 [this, &fields](const pointers &columns) {
+                   construct_row(columns, size_, abc::move(fields));
+                 });
+    } else {
+      construct_row(columns_, size_, abc::move(fields));
+    }
+    ++size_;
+    return back();
+  }
+  void push_back(const value_type &value) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); },
+               value);
+  }
+  void push_back(value_type &&value) {
+    std::apply([this](Ts &...fields) { emplace_back(abc::move(fields)...); },
+               value);
+  }
+  void pop_back() noexcept {
+    destroy_rows(size_ - 1, size_);
+    --size_;
+  }
+  void clear() noexcept {
+    destroy_rows(0, size_);
+    size_ = 0;
+  }
+  // Append value-initialized rows or erase the last rows.
+  void resize(size_type count) {
+    if (count > capacity_) {
+      reallocate(growth_policy_type::grow(size_, count),
+                 [](const pointers &) {});
+    }
+    for (; size_ < count; ++size_) {
+      construct_row(columns_, size_, std::tuple<>());
+    }
+    if (count < size_) {
+      destroy_rows(count, size_);
+      size_ = count;
+    }
+  }
+  // Erase the row at `pos` by moving the rows after it, column by column.
+  iterator erase(const_iterator pos) {
+    auto i = static_cast<size_type>(pos.i_);
+    for_each_column([this, i](auto *column) {
+      std::move(column + i + 1, column + size_, column + i);
+    }, columns_);
+    pop_back();
+    return begin() + i;
+  }
+
+ private:
+  struct layout_type {
+    std::array<std::size_t, kColumns> offsets;
+    std::size_t bytes;
+  };
+  // Lay the columns of `capacity` rows one after another, each padded to a
+  // multiple of `kAlignment` bytes.
+  static layout_type layout(size_type capacity) noexcept {
+    constexpr std::size_t kSizes[] = {sizeof(Ts)...};
+    auto result = layout_type{};
+    for (std::size_t i = 0; i != kColumns; ++i) {
+      result.offsets[i] = result.bytes;
+      result.bytes += (kSizes[i] * capacity + kAlignment - 1) / kAlignment *
+                      kAlignment;
+    }
+    return result;
+  }
+  static void *allocate(size_type capacity) {
+    if (capacity == 0) {
+      return nullptr;
+    }
+    record(stat::kAllocations);
+    return ::operator new(layout(capacity).bytes,
+                          std::align_val_t(kAlignment));
+  }
+  static void deallocate(void *block) noexcept {
+    if (block) {
+      record(stat::kDeallocations);
+      ::operator delete(block, std::align_val_t(kAlignment));
+    }
+  }
+  template <std::size_t... Is>
+  static pointers columns_of(void *block, size_type capacity,
+                             std::index_sequence<Is...>) noexcept {
+    auto bytes = static_cast<char *>(block);
+    auto offsets = layout(capacity).offsets;
+    return pointers(reinterpret_cast<Ts *>(bytes + offsets[Is])...);
+  }
+  // Call `f(std::get<I>(tuples)...)` for each column `I`.
+  template <class F, class... Tuples>
+  static void for_each_column(F &&f, Tuples &&...tuples) {
+    for_each_column_at(f, indices{}, tuples...);
+  }
+  template <class F, std::size_t... Is, class... Tuples>
+  static void for_each_column_at(F &f, std::index_sequence<Is...>,
+                                 Tuples &...tuples) {
+    (call_at<Is>(f, tuples...), ...);
+  }
+  template <std::size_t I, class F, class... Tuples>
+  static void call_at(F &f, Tuples &...tuples) {
+    f(std::get<I>(tuples)...);
+  }
+  // Construct the fields of row `i` from `fields` (or value-initialize them
+  // if it is empty), and destroy those constructed if one throws.
+  template <std::size_t I = 0, class Fields>
+  static void construct_row(const pointers &columns, size_type i,
+                            Fields &&fields) {
+    if constexpr (I != kColumns) {
+      using T = column_type<I>;
+      auto p = static_cast<void *>(std::get<I>(columns) + i);
+      if constexpr (std::tuple_size_v<std::decay_t<Fields>> == 0) {
+        ::new (p) T();
+      } else {
+        using Arg = std::tuple_element_t<I, std::decay_t<Fields>>;
+        ::new (p) T(std::get<I>(abc::move(fields)));
+        internal::count_construction<soa_vector, T, Arg>();
+      }
+      try {
+        construct_row<I + 1>(columns, i, std::forward<Fields>(fields));
+      } catch (...) {
+        std::get<I>(columns)[i].~T();
+        throw;
+      }
+    }
+  }
+  void destroy_rows(size_type first, size_type last) noexcept {
+    for_each_column([first, last](auto *column) {
+      std::destroy(column + first, column + last);
+    }, columns_);
+    record(stat::kDestructions, (last - first) * kColumns);
+  }
+  // Move [first, last) to uninitialized memory and end their lifetimes.
+  template <class T>
+  static void relocate(T *first, T *last, T *d_first) {
+    record(stat::kBytesRelocated, (last - first) * sizeof(T));
+    if constexpr (abc::is_trivially_relocatable_v<T>) {
+      if (first != last) {
+        std::memcpy(static_cast<void *>(d_first),
+                    static_cast<const void *>(first),
+                    (last - first) * sizeof(T));
+      }
+    } else {
+      std::uninitialized_move(first, last, d_first);
+      std::destroy(first, last);
+      record(stat::kMoves, last - first);
+      record(stat::kDestructions, last - first);
+    }
+  }
+  // Move the rows into a new block of `new_capacity` rows, after calling
+  // `construct(new_columns)`, which either constructs a new row or throws.
+  template <class Construct>
+  void reallocate(size_type new_capacity, Construct &&construct) {
+    auto new_block = allocate(new_capacity);
+    auto new_columns = columns_of(new_block, new_capacity, indices{});
+    try {
+      construct(new_columns);
+    } catch (...) {
+      deallocate(new_block);
+      throw;
+    }
+    if (block_) {
+      record(stat::kReallocations);
+    }
+    auto size = size_;
+    for_each_column([size](auto *first, auto *d_first) {
+      relocate(first, first + size, d_first);
+    }, columns_, new_columns);
+    deallocate(block_);
+    block_ = new_block;
+    columns_ = new_columns;
+    capacity_ = new_capacity;
+  }
+};
+
+namespace internal {
+
+template <class... Ts, std::size_t... Is>
+bool equal_columns(const soa_vector<Ts...> &lhs, const soa_vector<Ts...> &rhs,
+                   std::index_sequence<Is...>) {
+  auto n = lhs.size();
+  return (abc::equal(lhs.template data<Is>(), lhs.template data<Is>() + n,
+                     rhs.template data<Is>(), rhs.template data<Is>() + n) &&
+          ...);
+}
+
+}  // namespace internal
+
+// Vectors of different sizes are unequal at once, and the others are
+// compared column by column, each by abc::equal.
+template <class... Ts>
+bool operator==(const soa_vector<Ts...> &lhs, const soa_vector<Ts...> &rhs) {
+  return lhs.size() == rhs.size() &&
+         internal::equal_columns(lhs, rhs, std::index_sequence_for<Ts...>{});
+}
+template <class... Ts>
+bool operator!=(const soa_vector<Ts...> &lhs, const soa_vector<Ts...> &rhs) {
+  return !(lhs == rhs);
+}
+template <class... Ts>
+void swap(soa_vector<Ts...> &lhs, soa_vector<Ts...> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_SOA_VECTOR_H_
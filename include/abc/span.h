@@ -0,0 +1,40 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SPAN_H_
+#define ABC_SPAN_H_
+
+#include <cstddef>
+
+namespace abc {
+
+// A view of `size()` contiguous `T`s owned by others, as `std::span<T>` in
+// C++20.  Its iterators are raw pointers, so loops over it vectorize.
+template <class T>
+class span {
+ public:
+  using element_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using pointer = T *;
+  using iterator = T *;
+
+  constexpr span() noexcept = default;
+  constexpr span(T *data, size_type size) noexcept
+      : data_(data), size_(size) {}
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+  constexpr T *data() const noexcept { return data_; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr reference operator[](size_type i) const { return data_[i]; }
+  constexpr reference front() const { return data_[0]; }
+  constexpr reference back() const { return data_[size_ - 1]; }
+
+ private:
+  T *data_{nullptr};
+  size_type size_{0};
+};
+
+}  // namespace abc
+
+#endif  // ABC_SPAN_H_
@@ -0,0 +1,199 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_SPSC_RING_H_
+#define ABC_SPSC_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "abc/stats.h"
+#include "abc/utility.h"
+
+namespace abc {
+namespace internal {
+
+// Return the least power of 2 that is not less than `n` (at least 2).
+inline std::size_t ring_capacity(std::size_t n) noexcept {
+  std::size_t capacity = 2;
+  while (capacity < n) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+}  // namespace internal
+
+// A bounded queue between one producer thread and one consumer thread,
+// whose slots are allocated once, in a power-of-2 ring.
+//
+// The producer owns the tail and the consumer owns the head, each on its own
+// cache line.  Each side also keeps the last index it has read from the other
+// side, and only reloads that index (and its cache line) when the ring looks
+// too full or too empty for it.  A batch is published by a single store.
+//
+// Only one thread may call `try_push()` and `try_emplace()`, and only one
+// thread may call `try_pop()`, at a time.  A throw from a constructor leaves
+// the ring as it was, except for the elements of a batch that are already
+// pushed.
+template <class T, class Allocator = std::allocator<T>>
+class spsc_ring : private abc::ebo_storage<Allocator> {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using allocator_base = abc::ebo_storage<Allocator>;
+  Allocator &allocator() noexcept { return allocator_base::get(); }
+  const Allocator &allocator() const noexcept {
+    return allocator_base::get();
+  }
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<spsc_ring>(s, n);
+  }
+
+  // Read by both sides, but never written after construction:
+  T *slots_;
+  size_type mask_;
+  // Written by the producer:
+  alignas(64) std::atomic<size_type> tail_{0};
+  size_type cached_head_{0};
+  // Written by the consumer:
+  alignas(64) std::atomic<size_type> head_{0};
+  size_type cached_tail_{0};
+
+ public:
+  // Hold at least `capacity` elements, rounded up to a power of 2.
+  explicit spsc_ring(size_type capacity,
+                     const Allocator &alloc = Allocator())
+      : allocator_base(alloc),
+        slots_(alloc_traits::allocate(allocator(),
+                                      internal::ring_capacity(capacity))),
+        mask_(internal::ring_capacity(capacity) - 1) {
+    record(stat::kAllocations);
+  }
+  spsc_ring(const spsc_ring &) = delete;
+  spsc_ring &operator=(const spsc_ring &) = delete;
+  ~spsc_ring() noexcept {
+    auto tail = tail_.load(std::memory_order_acquire);
+    for (auto i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      destroy(slot(i));
+    }
+    alloc_traits::deallocate(allocator(), slots_, capacity());
+    record(stat::kDeallocations);
+  }
+  allocator_type get_allocator() const noexcept { return allocator(); }
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+  // May be stale once returned, unless called by the producer (an upper
+  // bound) or the consumer (a lower bound).
+  size_type size() const noexcept {
+    auto head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  // Called by the producer.  Construct an element at the tail and return
+  // true, or return false if the ring is full.
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    if (room(tail) == 0) {
+      return false;
+    }
+    construct(slot(tail), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+  bool try_push(const T &value) { return try_emplace(value); }
+  bool try_push(T &&value) { return try_emplace(abc::move(value)); }
+  // Called by the producer.  Push the longest prefix of [first, last) that
+  // fits, and return the end of that prefix.
+  template <class InputIt>
+  InputIt try_push(InputIt first, InputIt last) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    auto end = tail + room(tail, capacity());
+    auto i = tail;
+    try {
+      for (; i != end && first != last; ++i, ++first) {
+        construct(slot(i), *first);
+      }
+    } catch (...) {
+      tail_.store(i, std::memory_order_release);
+      throw;
+    }
+    tail_.store(i, std::memory_order_release);
+    return first;
+  }
+
+  // Called by the consumer.  Pop the head and return its value, or return
+  // `std::nullopt` if the ring is empty.
+  std::optional<T> try_pop() {
+    auto head = head_.load(std::memory_order_relaxed);
+    if (ready(head) == 0) {
+      return std::nullopt;
+    }
+    auto value = std::optional<T>(abc::move(*slot(head)));
+    record(stat::kMoves);
+    destroy(slot(head));
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+  }
+  // Called by the consumer.  Pop up to `count` elements into `d_first`, and
+  // return how many are popped.
+  template <class OutputIt>
+  size_type try_pop(OutputIt d_first, size_type count) {
+    auto head = head_.load(std::memory_order_relaxed);
+    count = std::min(count, ready(head, count));
+    size_type i = 0;
+    try {
+      for (; i != count; ++i, ++d_first) {
+        *d_first = abc::move(*slot(head + i));
+        destroy(slot(head + i));
+      }
+    } catch (...) {
+      // The slots before `i` are destroyed, so they must leave the ring:
+      head_.store(head + i, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  T *slot(size_type i) const noexcept { return slots_ + (i & mask_); }
+  // Return the number of free slots after the `tail`, seen by the producer,
+  // which reloads the head only if fewer than `wanted` slots are known.
+  size_type room(size_type tail, size_type wanted = 1) noexcept {
+    if (capacity() - (tail - cached_head_) < wanted) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+    }
+    return capacity() - (tail - cached_head_);
+  }
+  // Return the number of elements from the `head`, seen by the consumer,
+  // which reloads the tail only if fewer than `wanted` elements are known.
+  size_type ready(size_type head, size_type wanted = 1) noexcept {
+    if (cached_tail_ - head < wanted) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+    }
+    return cached_tail_ - head;
+  }
+  template <class... Args>
+  void construct(T *p, Args &&...args) {
+    alloc_traits::construct(allocator(), p, std::forward<Args>(args)...);
+    internal::count_construction<spsc_ring, T, Args...>();
+  }
+  void destroy(T *p) noexcept {
+    alloc_traits::destroy(allocator(), p);
+    record(stat::kDestructions);
+  }
+};  // spsc_ring
+
+}  // namespace abc
+
+#endif  // ABC_SPSC_RING_H_
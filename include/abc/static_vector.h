@@ -0,0 +1,355 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_STATIC_VECTOR_H_
+#define ABC_STATIC_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/iterator.h"
+
+namespace abc {
+namespace internal {
+
+// Whether adding to a full static_vector throws std::length_error.  A release
+// build (`NDEBUG`) may define `ABC_UNCHECKED_STATIC_VECTOR` to drop the check,
+// which must then be done the same way in all of its translation units.
+#if defined(NDEBUG) && defined(ABC_UNCHECKED_STATIC_VECTOR)
+inline constexpr bool kCheckStaticVectorCapacity = false;
+#else
+inline constexpr bool kCheckStaticVectorCapacity = true;
+#endif
+
+// The elements of a static_vector.  Trivial elements live in a plain array,
+// which constant expressions can read and write, at the cost of zeroing it on
+// construction.  The others are constructed in raw bytes when added.
+template <class T, std::size_t N, bool = std::is_trivial_v<T>>
+struct static_storage {
+  constexpr T *data() noexcept { return elements_; }
+  constexpr const T *data() const noexcept { return elements_; }
+  template <class... Args>
+  constexpr void construct(std::size_t i, Args&&... args) {
+    elements_[i] = T(std::forward<Args>(args)...);
+  }
+  constexpr void destroy(std::size_t, std::size_t) noexcept {}
+
+  std::size_t size_{0};
+  T elements_[N]{};
+};
+template <class T, std::size_t N>
+struct static_storage<T, N, false> {
+  T *data() noexcept {
+    return std::launder(reinterpret_cast<T *>(bytes_));
+  }
+  const T *data() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(bytes_));
+  }
+  template <class... Args>
+  void construct(std::size_t i, Args&&... args) {
+    ::new (static_cast<void *>(data() + i)) T(std::forward<Args>(args)...);
+  }
+  void destroy(std::size_t first, std::size_t last) noexcept {
+    std::destroy(data() + first, data() + last);
+  }
+
+  std::size_t size_{0};
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+};
+
+// Copy, move and destroy the elements of a static_vector.  For trivially
+// copyable `T`, all three are left trivial, so a static_vector is copied by
+// `std::memcpy` of all its `N` slots, which is branchless but wastes time on
+// a nearly empty one.
+template <class T, std::size_t N,
+          bool = std::is_trivially_copyable_v<T>>
+struct static_vector_base : static_storage<T, N> {};
+template <class T, std::size_t N>
+struct static_vector_base<T, N, false> : static_storage<T, N> {
+  static_vector_base() = default;
+  static_vector_base(const static_vector_base &that) {
+    std::uninitialized_copy_n(that.data(), that.size_, this->data());
+    this->size_ = that.size_;
+  }
+  static_vector_base(static_vector_base &&that) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    std::uninitialized_move_n(that.data(), that.size_, this->data());
+    this->size_ = that.size_;
+  }
+  static_vector_base &operator=(const static_vector_base &that) {
+    if (this != &that) {
+      assign(that.data(), that.size_);
+    }
+    return *this;
+  }
+  static_vector_base &operator=(static_vector_base &&that) noexcept(
+      std::is_nothrow_move_assignable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &that) {
+      assign(std::make_move_iterator(that.data()), that.size_);
+    }
+    return *this;
+  }
+  ~static_vector_base() noexcept {
+    this->destroy(0, this->size_);
+  }
+
+ private:
+  // Assign to the common prefix, then construct or destroy the rest.
+  template <class RandomIt>
+  void assign(RandomIt first, std::size_t count) {
+    auto common = std::min(count, this->size_);
+    std::copy_n(first, common, this->data());
+    if (count > this->size_) {
+      std::uninitialized_copy_n(first + common, count - common,
+                                this->data() + common);
+    } else {
+      this->destroy(count, this->size_);
+    }
+    this->size_ = count;
+  }
+};
+
+}  // namespace internal
+
+// A vector of at most `N` elements stored inside itself, which never calls an
+// allocator.  It offers the interface of abc::vector, but its capacity is
+// fixed, so adding to a full one throws std::length_error (see
+// `internal::kCheckStaticVectorCapacity` for dropping the check).
+//
+// A static_vector of trivially copyable `T` is itself trivially copyable.  One
+// of trivial `T` (e.g. `int` or a plain struct) can be built, filled and read
+// in constant expressions.  Unlike abc::vector, moving a static_vector moves
+// each element, and leaves the moved-from elements in place.
+template <class T, std::size_t N>
+class static_vector : private internal::static_vector_base<T, N> {
+  static_assert(N > 0, "A static_vector must hold at least one element.");
+  using base = internal::static_vector_base<T, N>;
+  using base::size_;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  // construction
+  constexpr static_vector() noexcept = default;
+  constexpr explicit static_vector(size_type count, const T &value = T()) {
+    assign(count, value);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  constexpr static_vector(InputIt first, InputIt last) {
+    assign(first, last);
+  }
+  constexpr static_vector(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+  }
+  constexpr static_vector &operator=(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+  // copy, move and destruction are those of `base`
+  static_vector(const static_vector &) = default;
+  static_vector(static_vector &&) = default;
+  static_vector &operator=(const static_vector &) = default;
+  static_vector &operator=(static_vector &&) = default;
+  ~static_vector() = default;
+
+  // iterator and related methods
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size_; }
+  constexpr const_iterator cbegin() const noexcept { return data(); }
+  constexpr const_iterator cend() const noexcept { return data() + size_; }
+  constexpr const_iterator begin() const noexcept { return cbegin(); }
+  constexpr const_iterator end() const noexcept { return cend(); }
+
+  // non-modifying methods
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr bool full() const noexcept { return size_ == N; }
+  constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type capacity() noexcept { return N; }
+  static constexpr size_type max_size() noexcept { return N; }
+  constexpr T *data() noexcept { return base::data(); }
+  constexpr const T *data() const noexcept { return base::data(); }
+  // element accessors (without check)
+  constexpr reference operator[](size_type pos) { return data()[pos]; }
+  constexpr const_reference operator[](size_type pos) const {
+    return data()[pos];
+  }
+  constexpr reference front() { return data()[0]; }
+  constexpr const_reference front() const { return data()[0]; }
+  constexpr reference back() { return data()[size_ - 1]; }
+  constexpr const_reference back() const { return data()[size_ - 1]; }
+  // element accessors (with check)
+  constexpr reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return data()[pos];
+  }
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("The given index is illegal!");
+    }
+    return data()[pos];
+  }
+  // capacity methods, which are no-ops as long as `N` is enough
+  constexpr void reserve(size_type new_capacity) {
+    check_room(new_capacity, 0);
+  }
+  constexpr void shrink_to_fit() noexcept {}
+  // modifying methods
+  constexpr void resize(size_type count, const T &value = T()) {
+    if (count > size_) {
+      check_room(count, size_);
+      while (size_ != count) {
+        base::construct(size_, value);
+        ++size_;
+      }
+    } else {
+      base::destroy(count, size_);
+      size_ = count;
+    }
+  }
+  template <class... Args>
+  constexpr reference emplace_back(Args&&... args) {
+    check_room(1, size_);
+    base::construct(size_, std::forward<Args>(args)...);
+    return data()[size_++];
+  }
+  constexpr void push_back(const T &value) { emplace_back(value); }
+  constexpr void push_back(T &&value) { emplace_back(std::move(value)); }
+  // Return the new element, or `nullptr` if `full()`, whatever the check.
+  template <class... Args>
+  constexpr pointer try_emplace_back(Args&&... args) {
+    if (full()) {
+      return nullptr;
+    }
+    base::construct(size_, std::forward<Args>(args)...);
+    return data() + size_++;
+  }
+  constexpr void pop_back() {
+    --size_;
+    base::destroy(size_, size_ + 1);
+  }
+  constexpr void clear() noexcept {
+    base::destroy(0, size_);
+    size_ = 0;
+  }
+  constexpr void assign(size_type count, const T &value) {
+    clear();
+    resize(count, value);
+  }
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  constexpr void assign(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+  constexpr void assign(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+  }
+  constexpr iterator insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+  }
+  constexpr iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+  // Append the new element, then rotate it into `pos`.
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args&&... args) {
+    auto index = pos - cbegin();
+    emplace_back(std::forward<Args>(args)...);
+    std::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+  constexpr iterator erase(const_iterator pos) {
+    return erase(pos, pos + 1);
+  }
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    auto index = first - cbegin();
+    auto count = static_cast<size_type>(last - first);
+    if (count) {
+      std::move(begin() + index + count, end(), begin() + index);
+      base::destroy(size_ - count, size_);
+      size_ -= count;
+    }
+    return begin() + index;
+  }
+  void swap(static_vector &that) noexcept(
+      std::is_nothrow_swappable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>) {
+    auto &shorter = size_ < that.size_ ? *this : that;
+    auto &longer = size_ < that.size_ ? that : *this;
+    auto common = shorter.size_;
+    std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+    std::uninitialized_move(longer.begin() + common, longer.end(),
+                            shorter.end());
+    longer.destroy(common, longer.size_);
+    std::swap(size_, that.size_);
+  }
+
+ private:
+  // Make sure that `count` more elements fit in after the first `size`.
+  static constexpr void check_room(size_type count, size_type size) {
+    if constexpr (internal::kCheckStaticVectorCapacity) {
+      if (count > N - size) {
+        throw std::length_error("The static_vector is full!");
+      }
+    }
+  }
+};
+template <class T, std::size_t N>
+bool operator==(const abc::static_vector<T, N> &lhs,
+                const abc::static_vector<T, N> &rhs) {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class T, std::size_t N>
+bool operator!=(const abc::static_vector<T, N> &lhs,
+                const abc::static_vector<T, N> &rhs) {
+  return !(lhs == rhs);
+}
+template <class T, std::size_t N>
+bool operator<(const abc::static_vector<T, N> &lhs,
+               const abc::static_vector<T, N> &rhs) {
+  return abc::lexicographical_compare(lhs.begin(), lhs.end(),
+                                      rhs.begin(), rhs.end());
+}
+template <class T, std::size_t N>
+bool operator>(const abc::static_vector<T, N> &lhs,
+               const abc::static_vector<T, N> &rhs) {
+  return rhs < lhs;
+}
+template <class T, std::size_t N>
+bool operator<=(const abc::static_vector<T, N> &lhs,
+                const abc::static_vector<T, N> &rhs) {
+  return !(rhs < lhs);
+}
+template <class T, std::size_t N>
+bool operator>=(const abc::static_vector<T, N> &lhs,
+                const abc::static_vector<T, N> &rhs) {
+  return !(lhs < rhs);
+}
+template <class T, std::size_t N>
+void swap(abc::static_vector<T, N> &lhs, abc::static_vector<T, N> &rhs)
+    noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_STATIC_VECTOR_H_
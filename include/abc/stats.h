@@ -0,0 +1,164 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_STATS_H_
+#define ABC_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>  // NOLINT
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Define `ABC_ENABLE_STATS` (in every translation unit of a program) to count
+// the operations done by abc containers.  Otherwise, counting costs nothing.
+namespace abc {
+
+#ifdef ABC_ENABLE_STATS
+inline constexpr bool kStatsEnabled = true;
+#else
+inline constexpr bool kStatsEnabled = false;
+#endif
+
+// The operations counted for each container type.
+enum class stat : int {
+  kAllocations,     // blocks (or nodes) obtained from the allocator
+  kDeallocations,   // blocks (or nodes) returned to the allocator
+  kReallocations,   // times the elements were moved to a new block
+  kBytesRelocated,  // bytes of elements moved to another address
+  kCopies,          // elements constructed by copying
+  kMoves,           // elements constructed by moving
+  kDestructions,    // elements destroyed
+  kCount,
+};
+
+// A snapshot of the counts of one container type.
+struct container_stats {
+  std::size_t allocations{0};
+  std::size_t deallocations{0};
+  std::size_t reallocations{0};
+  std::size_t bytes_relocated{0};
+  std::size_t copies{0};
+  std::size_t moves{0};
+  std::size_t destructions{0};
+
+  container_stats operator-(const container_stats &that) const noexcept {
+    return {allocations - that.allocations,
+            deallocations - that.deallocations,
+            reallocations - that.reallocations,
+            bytes_relocated - that.bytes_relocated,
+            copies - that.copies, moves - that.moves,
+            destructions - that.destructions};
+  }
+};
+
+namespace internal {
+
+// The live counters of one container type, updated by any thread.
+class atomic_stats {
+  std::atomic<std::size_t> counts_[static_cast<int>(stat::kCount)]{};
+
+ public:
+  void add(stat s, std::size_t n) noexcept {
+    counts_[static_cast<int>(s)].fetch_add(n, std::memory_order_relaxed);
+  }
+  std::size_t get(stat s) const noexcept {
+    return counts_[static_cast<int>(s)].load(std::memory_order_relaxed);
+  }
+  container_stats load() const noexcept {
+    return {get(stat::kAllocations), get(stat::kDeallocations),
+            get(stat::kReallocations), get(stat::kBytesRelocated),
+            get(stat::kCopies), get(stat::kMoves), get(stat::kDestructions)};
+  }
+};
+
+// All container types that have been counted, in order of first use.
+class stats_list {
+  std::mutex mutex_;
+  std::vector<std::pair<const std::type_info *, const atomic_stats *>> list_;
+
+ public:
+  static stats_list &instance() {
+    static stats_list list;
+    return list;
+  }
+  void add(const std::type_info *type, const atomic_stats *stats) {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    list_.emplace_back(type, stats);
+  }
+  template <class Visitor>
+  void for_each(Visitor &&visit) {
+    auto lock = std::lock_guard<std::mutex>(mutex_);
+    for (const auto &entry : list_) {
+      visit(*entry.first, entry.second->load());
+    }
+  }
+};
+
+template <class Container>
+atomic_stats &stats_of() {
+  static auto *stats = [] {
+    static atomic_stats stats;
+    stats_list::instance().add(&typeid(Container), &stats);
+    return &stats;
+  }();
+  return *stats;
+}
+
+// Add `n` to the count `s` of `Container`, if counting is enabled.
+template <class Container>
+void count(stat s, std::size_t n = 1) noexcept {
+  if constexpr (kStatsEnabled) {
+    stats_of<Container>().add(s, n);
+  }
+}
+// Count the construction of a `T` from `Args`, which is a copy or a move if
+// `Args` is a single `T`.
+template <class Container, class T, class... Args>
+void count_construction(std::size_t n = 1) noexcept {
+  if constexpr (sizeof...(Args) == 1) {
+    using Arg = std::tuple_element_t<0, std::tuple<Args...>>;
+    if constexpr (std::is_same_v<std::decay_t<Arg>, T>) {
+      constexpr bool kMoved = !std::is_lvalue_reference_v<Arg> &&
+                              !std::is_const_v<std::remove_reference_t<Arg>>;
+      count<Container>(kMoved ? stat::kMoves : stat::kCopies, n);
+    }
+  }
+}
+
+}  // namespace internal
+
+// Read the counts of every container type, or of a given one.
+class stats_registry {
+ public:
+  template <class Container>
+  static container_stats get() {
+    return internal::stats_of<Container>().load();
+  }
+  // Call `visit(const std::type_info &, const container_stats &)` for each
+  // container type counted so far.
+  template <class Visitor>
+  static void for_each(Visitor &&visit) {
+    internal::stats_list::instance().for_each(std::forward<Visitor>(visit));
+  }
+};
+
+// Remember the counts of `Container` on construction, so that `delta()`
+// returns those counted during the lifetime of this scope.
+template <class Container>
+class stats_scope {
+  container_stats start_{stats_registry::get<Container>()};
+
+ public:
+  stats_scope() = default;
+  stats_scope(const stats_scope &) = delete;
+  stats_scope &operator=(const stats_scope &) = delete;
+  container_stats delta() const {
+    return stats_registry::get<Container>() - start_;
+  }
+};
+
+}  // namespace abc
+
+#endif  // ABC_STATS_H_
@@ -0,0 +1,419 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_THREAD_POOL_H_
+#define ABC_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>  // NOLINT
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>  // NOLINT
+#include <memory>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace abc {
+namespace internal {
+
+// A unit of work run by an abc::thread_pool.
+class task {
+ public:
+  virtual void run() = 0;
+
+ protected:
+  ~task() = default;
+};
+
+// The work-stealing deque of Chase and Lev, in the C11 formulation of Lê et
+// al. (PPoPP 2013).  The owner pushes and pops at the bottom, while other
+// threads steal from the top; only the last element is contended.  Grown
+// arrays are kept until destruction, since thieves may still read them.
+template <class T>
+class chase_lev_deque {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  class array {
+    std::int64_t mask_;
+    std::unique_ptr<std::atomic<T>[]> slots_;
+
+   public:
+    explicit array(std::int64_t capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+    std::int64_t capacity() const noexcept { return mask_ + 1; }
+    T get(std::int64_t i) const noexcept {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, T x) noexcept {
+      slots_[i & mask_].store(x, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(64) std::atomic<std::int64_t> top_{0};
+  alignas(64) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<array *> array_;
+  std::vector<std::unique_ptr<array>> arrays_;  // touched by the owner only
+
+ public:
+  explicit chase_lev_deque(std::int64_t capacity = 256) {
+    arrays_.push_back(std::make_unique<array>(capacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  // Called by the owner only.
+  void push(T x) {
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_acquire);
+    auto *a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->capacity() - 1) {
+      arrays_.push_back(std::make_unique<array>(a->capacity() * 2));
+      auto *bigger = arrays_.back().get();
+      for (auto i = t; i != b; ++i) {
+        bigger->put(i, a->get(i));
+      }
+      array_.store(bigger, std::memory_order_release);
+      a = bigger;
+    }
+    a->put(b, x);
+    // Also ordered before the check for sleeping workers by the pool:
+    bottom_.store(b + 1, std::memory_order_seq_cst);
+  }
+  // Called by the owner only.  Return `T()` if empty.
+  T pop() {
+    auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    auto *a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_seq_cst);
+    auto x = T();
+    if (t <= b) {
+      x = a->get(b);
+      if (t == b) {  // the last one, which thieves may be stealing
+        if (!top_.compare_exchange_strong(t, t + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          x = T();
+        }
+        bottom_.store(b + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return x;
+  }
+  // Called by any thread.  Return `T()` if empty or lost a race.
+  T steal() {
+    auto t = top_.load(std::memory_order_seq_cst);
+    auto b = bottom_.load(std::memory_order_seq_cst);
+    if (t < b) {
+      auto x = array_.load(std::memory_order_acquire)->get(t);
+      if (top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return x;
+      }
+    }
+    return T();
+  }
+  bool empty() const noexcept {
+    return bottom_.load(std::memory_order_seq_cst) <=
+           top_.load(std::memory_order_seq_cst);
+  }
+};
+
+}  // namespace internal
+
+// A fixed set of worker threads, each of which owns a deque of tasks.
+//
+// A task spawned by a worker (by `submit()`, `invoke()` or `parallel_for()`)
+// is pushed to its own deque, which it pops in LIFO order; a worker whose
+// deque is empty takes tasks submitted by other threads, then steals the
+// oldest task of a random victim, then sleeps.  A thread waiting for a forked
+// task runs other tasks meanwhile, so nested fork-join never deadlocks.
+class thread_pool {
+  using task = internal::task;
+
+ public:
+  // Leave a core to the thread that calls `parallel_for()`, which also works.
+  static unsigned default_size() noexcept {
+    auto n = std::thread::hardware_concurrency();
+    return n > 1 ? n - 1 : 1;
+  }
+  // The pool shared by the parallel algorithms by default.
+  static thread_pool &instance() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  explicit thread_pool(unsigned num_workers = default_size()) {
+    num_workers = std::max(num_workers, 1u);
+    // All deques exist before any worker may steal from them.
+    workers_.reserve(num_workers);
+    for (unsigned i = 0; i != num_workers; ++i) {
+      workers_.push_back(std::make_unique<worker>());
+    }
+    for (unsigned i = 0; i != num_workers; ++i) {
+      workers_[i]->thread = std::thread([this, i] { work(i); });
+    }
+  }
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  // Run all tasks, including those they spawn, then join the workers.
+  ~thread_pool() {
+    {
+      auto lock = std::lock_guard<std::mutex>(sleep_mutex_);
+      stopping_ = true;
+    }
+    wake_up_.notify_all();
+    for (auto &w : workers_) {
+      w->thread.join();
+    }
+  }
+
+  unsigned size() const noexcept { return workers_.size(); }
+
+  // Run `task()` on a worker and return the future of its result.  Waiting
+  // for it blocks the thread, so tasks should join others by `invoke()`.
+  template <class F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F &&f) {
+    using R = std::invoke_result_t<std::decay_t<F>>;
+    auto *t = new heap_task<std::packaged_task<R()>>(std::forward<F>(f));
+    auto future = t->f.get_future();
+    spawn(t);
+    return future;
+  }
+
+  // Run `f()` and `g()` in parallel and return once both have returned, by
+  // forking `g()` and then running `f()`.  If either throws, the exception is
+  // rethrown after both have finished.
+  template <class F, class G>
+  void invoke(F &&f, G &&g) {
+    auto forked = join_task<std::remove_reference_t<G>>(&g);
+    spawn(&forked);
+    auto error = std::exception_ptr();
+    try {
+      f();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    while (!forked.done()) {
+      if (!run_one()) {
+        std::this_thread::yield();
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    forked.rethrow_if_failed();
+  }
+
+  // Call `f(i)` for each `i` in `[first, last)` in parallel, and return once
+  // all calls have returned.  The range is halved until no longer than
+  // `grain`.  By default (i.e. `grain == 0`), a worker only halves its range
+  // while its previous halves have been stolen, which adapts the splitting
+  // to the load; otherwise, it runs the next few indices itself.
+  template <class F>
+  void parallel_for(std::size_t first, std::size_t last, F &&f,
+                    std::size_t grain = 0) {
+    if (first >= last) {
+      return;
+    }
+    auto adaptive = (grain == 0);
+    if (adaptive) {
+      grain = std::max<std::size_t>(1, (last - first) / (64 * (size() + 1)));
+    }
+    for_range(first, last, f, grain, adaptive);
+  }
+
+ private:
+  template <class F>
+  struct heap_task final : task {
+    F f;
+    template <class... Args>
+    explicit heap_task(Args &&... args) : f(std::forward<Args>(args)...) {}
+    void run() override {
+      f();
+      delete this;
+    }
+  };
+  // A task on the stack of the thread that waits for it.
+  template <class F>
+  class join_task final : public task {
+    F *f_;
+    std::exception_ptr error_;
+    std::atomic<bool> done_{false};
+
+   public:
+    explicit join_task(F *f) : f_(f) {}
+    void run() override {
+      try {
+        (*f_)();
+      } catch (...) {
+        error_ = std::current_exception();
+      }
+      done_.store(true, std::memory_order_release);
+    }
+    bool done() const noexcept {
+      return done_.load(std::memory_order_acquire);
+    }
+    void rethrow_if_failed() const {
+      if (error_) {
+        std::rethrow_exception(error_);
+      }
+    }
+  };
+  struct worker {
+    internal::chase_lev_deque<task *> deque;
+    std::thread thread;
+  };
+
+  // The worker running on this thread, if it belongs to this pool.
+  worker *current() const noexcept {
+    return tls_pool_ == this ? workers_[tls_index_].get() : nullptr;
+  }
+
+  template <class F>
+  void for_range(std::size_t first, std::size_t last, F &f,
+                 std::size_t grain, bool adaptive) {
+    while (last - first > grain) {
+      auto *self = current();
+      if (adaptive && self && !self->deque.empty()) {
+        // Nobody has stolen the halves forked so far, so keep working:
+        for (auto end = first + grain; first != end; ++first) {
+          f(first);
+        }
+        continue;
+      }
+      auto mid = first + (last - first) / 2;
+      invoke([&] { for_range(first, mid, f, grain, adaptive); },
+             [&] { for_range(mid, last, f, grain, adaptive); });
+      return;
+    }
+    for (; first != last; ++first) {
+      f(first);
+    }
+  }
+
+  void spawn(task *t) {
+    if (auto *self = current()) {
+      self->deque.push(t);
+    } else {
+      auto lock = std::lock_guard<std::mutex>(injected_mutex_);
+      injected_.push_back(t);
+      num_injected_.fetch_add(1, std::memory_order_seq_cst);
+    }
+    if (num_sleeping_.load(std::memory_order_seq_cst) > 0) {
+      auto lock = std::lock_guard<std::mutex>(sleep_mutex_);
+      wake_up_.notify_one();
+    }
+  }
+  task *take_injected() {
+    if (num_injected_.load(std::memory_order_relaxed) == 0) {
+      return nullptr;
+    }
+    auto lock = std::lock_guard<std::mutex>(injected_mutex_);
+    if (injected_.empty()) {
+      return nullptr;
+    }
+    auto *t = injected_.front();
+    injected_.pop_front();
+    num_injected_.fetch_sub(1, std::memory_order_relaxed);
+    return t;
+  }
+  task *steal() {
+    // A xorshift generator per thread picks the first victim.  Seeded by the
+    // thread's id, thieves probe the victims in different orders.  The seed
+    // is made odd, since xorshift would stay at zero:
+    static thread_local std::uint32_t seed = std::uint32_t(
+        std::uint64_t(std::hash<std::thread::id>()(std::this_thread::get_id()))
+        * 0x9E3779B97F4A7C15u >> 32) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    auto n = workers_.size(), first = std::size_t(seed % n);
+    for (std::size_t i = 0; i != n; ++i) {
+      if (auto *t = workers_[(first + i) % n]->deque.steal()) {
+        return t;
+      }
+    }
+    return nullptr;
+  }
+  task *find_task() {
+    task *t = nullptr;
+    if (auto *self = current()) {
+      t = self->deque.pop();
+    }
+    if (!t) {
+      t = take_injected();
+    }
+    if (!t) {
+      t = steal();
+    }
+    return t;
+  }
+  bool run_one() {
+    if (auto *t = find_task()) {
+      t->run();
+      return true;
+    }
+    return false;
+  }
+  bool has_work() const noexcept {
+    if (num_injected_.load(std::memory_order_seq_cst)) {
+      return true;
+    }
+    for (auto &w : workers_) {
+      if (!w->deque.empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(std::size_t index) {
+    tls_pool_ = this;
+    tls_index_ = index;
+    constexpr int kSpins = 16;
+    for (int idle = 0; ; ) {
+      if (run_one()) {
+        idle = 0;
+      } else if (++idle < kSpins) {
+        std::this_thread::yield();
+      } else {
+        // Announce sleeping before the last look, so that a task spawned
+        // after the look will wake this worker up.
+        auto lock = std::unique_lock<std::mutex>(sleep_mutex_);
+        num_sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        if (!has_work()) {
+          if (stopping_) {
+            num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+            break;
+          }
+          wake_up_.wait(lock);
+        }
+        num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+      }
+    }
+    tls_pool_ = nullptr;
+  }
+
+  static inline thread_local const thread_pool *tls_pool_ = nullptr;
+  static inline thread_local std::size_t tls_index_ = 0;
+
+  std::vector<std::unique_ptr<worker>> workers_;
+  std::mutex injected_mutex_;
+  std::deque<task *> injected_;
+  std::atomic<std::size_t> num_injected_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_up_;
+  std::atomic<int> num_sleeping_{0};
+  bool stopping_{false};
+};
+
+}  // namespace abc
+
+#endif  // ABC_THREAD_POOL_H_
@@ -2,6 +2,9 @@
 #ifndef ABC_TYPE_TRAITS_H_
 #define ABC_TYPE_TRAITS_H_
 
+#include <memory>
+#include <type_traits>
+
 namespace abc {
 
 template <class T> struct remove_reference      { using type = T; };
@@ -11,6 +14,21 @@ template <class T> struct remove_reference<T&&> { using type = T; };
 template <class T>
 using remove_reference_t = typename remove_reference<T>::type;
 
+// An object is trivially relocatable, if moving it to a new address and then
+// destroying the source is equivalent to copying its bytes by `std::memcpy`.
+// All trivially copyable types are, and other types may opt in by
+// specializing this trait.
+template <class T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+// `std::unique_ptr` only holds a pointer (and an empty deleter):
+template <class T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
 }  // namespace abc
 
 #endif  // ABC_TYPE_TRAITS_H_
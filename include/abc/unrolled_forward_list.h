@@ -0,0 +1,432 @@
+// Copyright 2026 Weicheng Pei
+#ifndef ABC_UNROLLED_FORWARD_LIST_H_
+#define ABC_UNROLLED_FORWARD_LIST_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "abc/algorithm.h"
+#include "abc/iterator.h"
+#include "abc/stats.h"
+#include "abc/utility.h"
+
+namespace abc {
+namespace internal {
+
+// The default number of elements per node of abc::unrolled_forward_list,
+// which makes a node span about four cache lines.
+template <class T>
+constexpr std::size_t default_unroll() {
+  constexpr std::size_t kBytes = 256 - 2 * sizeof(void *);
+  return sizeof(T) * 4 <= kBytes ? kBytes / sizeof(T) : 4;
+}
+
+}  // namespace internal
+
+// A forward_list whose nodes hold up to `K` elements each, so that a scan
+// takes a cache miss per node rather than per element.
+//
+// Every node but the last holds at least `K / 2` elements: inserting into a
+// full node splits it in halves (unless appending to the last one), and
+// erasing from a half-full node merges it with, or borrows from, the next.
+// Elements are shifted within and between nodes, so inserting or erasing
+// invalidates the iterators into the nodes involved.
+template <class T, std::size_t K = internal::default_unroll<T>(),
+          class Allocator = std::allocator<T>>
+class unrolled_forward_list {
+  static_assert(K >= 2, "A full node must be splittable.");
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "Shifting elements must not throw.");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  static constexpr size_type kNodeCapacity = K;
+
+ public:
+  unrolled_forward_list() = default;
+  explicit unrolled_forward_list(const Allocator &alloc)
+      : head_(NodeAllocator(alloc)) {}
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  unrolled_forward_list(InputIt first, InputIt last,
+                        const Allocator &alloc = Allocator())
+      : unrolled_forward_list(alloc) {
+    insert_after(before_begin(), first, last);
+  }
+  unrolled_forward_list(std::initializer_list<T> init,
+                        const Allocator &alloc = Allocator())
+      : unrolled_forward_list(init.begin(), init.end(), alloc) {}
+  ~unrolled_forward_list() noexcept { clear(); }
+  // copy operations:
+  unrolled_forward_list(const unrolled_forward_list &that)
+      : head_(node_alloc_traits::select_on_container_copy_construction(
+            that.node_allocator())) {
+    insert_after(before_begin(), that.begin(), that.end());
+  }
+  unrolled_forward_list &operator=(const unrolled_forward_list &that) {
+    if (this != &that) {
+      clear();
+      if constexpr (
+          node_alloc_traits::propagate_on_container_copy_assignment::value) {
+        node_allocator() = that.node_allocator();
+      }
+      insert_after(before_begin(), that.begin(), that.end());
+    }
+    return *this;
+  }
+  // move operations:
+  unrolled_forward_list(unrolled_forward_list &&that) noexcept
+      : head_(abc::move(that.node_allocator())) {
+    std::swap(head_.ptr_next, that.head_.ptr_next);
+  }
+  unrolled_forward_list &operator=(unrolled_forward_list &&that) noexcept(
+      node_alloc_traits::propagate_on_container_move_assignment::value ||
+      node_alloc_traits::is_always_equal::value) {
+    if (this != &that) {
+      clear();
+      if constexpr (
+          !node_alloc_traits::propagate_on_container_move_assignment::value &&
+          !node_alloc_traits::is_always_equal::value) {
+        if (node_allocator() != that.node_allocator()) {
+          // cannot steal nodes from another allocator, so move one by one:
+          insert_after(before_begin(), std::make_move_iterator(that.begin()),
+                       std::make_move_iterator(that.end()));
+          that.clear();
+          return *this;
+        }
+      }
+      if constexpr (
+          node_alloc_traits::propagate_on_container_move_assignment::value) {
+        node_allocator() = abc::move(that.node_allocator());
+      }
+      std::swap(head_.ptr_next, that.head_.ptr_next);
+    }
+    return *this;
+  }
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(node_allocator());
+  }
+  // accessors:
+  bool empty() const noexcept { return !head_.ptr_next; }
+  reference front() { return *head_.ptr_next->data(); }
+  const_reference front() const { return *head_.ptr_next->data(); }
+  // mutators:
+  void clear() noexcept {
+    auto ptr_node = head_.ptr_next;
+    while (ptr_node) {
+      auto ptr_next = ptr_node->ptr_next;
+      delete_node(ptr_node);
+      ptr_node = ptr_next;
+    }
+    head_.ptr_next = nullptr;
+  }
+  void swap(unrolled_forward_list &that) noexcept {
+    if constexpr (node_alloc_traits::propagate_on_container_swap::value) {
+      std::swap(node_allocator(), that.node_allocator());
+    }
+    std::swap(head_.ptr_next, that.head_.ptr_next);
+  }
+
+ private:
+  struct Node;
+  // The link part of a node, which is also the head of the list.  The head
+  // holds no element, so `before_begin()` steps to the first node.
+  struct NodeBase {
+    Node *ptr_next{ nullptr };
+    size_type count{ 0 };
+  };
+  struct Node : NodeBase {
+    alignas(T) unsigned char bytes[K * sizeof(T)];
+    Node() noexcept {}  // leave `bytes` uninitialized
+    T *data() noexcept { return reinterpret_cast<T *>(bytes); }
+  };
+
+ private:
+  using node_alloc_traits = typename std::allocator_traits<
+      Allocator>::template rebind_traits<Node>;
+  using NodeAllocator = typename node_alloc_traits::allocator_type;
+  // The head is stored together with the allocator, which takes no space if
+  // it is empty.
+  struct Head : abc::ebo_storage<NodeAllocator>, NodeBase {
+    using abc::ebo_storage<NodeAllocator>::ebo_storage;
+  };
+  Head head_;  // the only data member of unrolled_forward_list<T>
+
+  NodeAllocator &node_allocator() noexcept { return head_.get(); }
+  const NodeAllocator &node_allocator() const noexcept { return head_.get(); }
+  NodeBase *before_head() const noexcept {
+    return const_cast<Head *>(&head_);
+  }
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<unrolled_forward_list>(s, n);
+  }
+  // Link a new empty node after `ptr_prev`.
+  Node *new_node_after(NodeBase *ptr_prev) {
+    auto ptr_new = node_alloc_traits::allocate(node_allocator(), 1);
+    record(stat::kAllocations);
+    node_alloc_traits::construct(node_allocator(), ptr_new);
+    ptr_new->ptr_next = ptr_prev->ptr_next;
+    ptr_prev->ptr_next = ptr_new;
+    return ptr_new;
+  }
+  // Unlink the node after `ptr_prev` and delete it with its elements.
+  void delete_after(NodeBase *ptr_prev) noexcept {
+    auto ptr_old = ptr_prev->ptr_next;
+    ptr_prev->ptr_next = ptr_old->ptr_next;
+    delete_node(ptr_old);
+  }
+  void delete_node(Node *ptr_old) noexcept {
+    for (size_type i = 0; i != ptr_old->count; ++i) {
+      node_alloc_traits::destroy(node_allocator(), ptr_old->data() + i);
+    }
+    record(stat::kDestructions, ptr_old->count);
+    node_alloc_traits::destroy(node_allocator(), ptr_old);
+    node_alloc_traits::deallocate(node_allocator(), ptr_old, 1);
+    record(stat::kDeallocations);
+  }
+  // Move the element at `from` to the empty slot at `to`.
+  void relocate(T *from, T *to) noexcept {
+    node_alloc_traits::construct(node_allocator(), to, abc::move(*from));
+    node_alloc_traits::destroy(node_allocator(), from);
+  }
+  // Move `n` elements from `from` to the empty slots at `to`, which may
+  // overlap (e.g. when shifting within a node).
+  void relocate_n(T *from, size_type n, T *to) noexcept {
+    if (to < from) {
+      for (size_type i = 0; i != n; ++i) {
+        relocate(from + i, to + i);
+      }
+    } else {
+      for (size_type i = n; i != 0; --i) {
+        relocate(from + i - 1, to + i - 1);
+      }
+    }
+    record(stat::kMoves, n);
+  }
+  // Construct an element at index `i` of `ptr_node`, splitting it if full.
+  template <class... Args>
+  std::pair<Node *, size_type> insert_at(Node *ptr_node, size_type i,
+                                         Args&&... args) {
+    if (ptr_node->count == K) {
+      // Allocate before shifting anything, so that a throw changes nothing:
+      auto ptr_new = new_node_after(ptr_node);
+      if (i == K && !ptr_new->ptr_next) {
+        // Appending to the last node starts a new one, so that a list built
+        // from front to back has full nodes.
+        ptr_node = ptr_new;
+        i = 0;
+      } else {
+        constexpr size_type kHalf = K / 2;
+        relocate_n(ptr_node->data() + kHalf, K - kHalf, ptr_new->data());
+        ptr_new->count = K - kHalf;
+        ptr_node->count = kHalf;
+        if (i > kHalf) {
+          ptr_node = ptr_new;
+          i -= kHalf;
+        }
+      }
+    }
+    auto data = ptr_node->data();
+    relocate_n(data + i, ptr_node->count - i, data + i + 1);
+    node_alloc_traits::construct(node_allocator(), data + i,
+                                 abc::forward<Args>(args)...);
+    ++ptr_node->count;
+    internal::count_construction<unrolled_forward_list, T, Args...>();
+    return {ptr_node, i};
+  }
+  // Refill `ptr_node` from the next node, if it is less than half full.
+  void rebalance(Node *ptr_node) noexcept {
+    auto ptr_next = ptr_node->ptr_next;
+    if (ptr_node->count >= K / 2 || !ptr_next) {
+      return;
+    }
+    auto data = ptr_node->data();
+    if (ptr_node->count + ptr_next->count <= K) {
+      relocate_n(ptr_next->data(), ptr_next->count, data + ptr_node->count);
+      ptr_node->count += ptr_next->count;
+      ptr_next->count = 0;
+      delete_after(ptr_node);
+    } else {
+      // The next node has more than `K / 2` elements, so one will do:
+      relocate_n(ptr_next->data(), 1, data + ptr_node->count++);
+      relocate_n(ptr_next->data() + 1, --ptr_next->count, ptr_next->data());
+    }
+  }
+
+ public:  // iterators and related methods
+  class iterator : public abc::iterator<
+      std::forward_iterator_tag, unrolled_forward_list::value_type> {
+    friend unrolled_forward_list;
+   protected:
+    NodeBase *ptr_node{ nullptr };
+    size_type index{ 0 };
+   public:
+    iterator() noexcept = default;
+    iterator(NodeBase *ptr_node, size_type index) noexcept
+        : ptr_node(ptr_node), index(index) { }
+    reference operator*() const noexcept {
+      return static_cast<Node *>(ptr_node)->data()[index];
+    }
+    pointer operator->() const noexcept { return &this->operator*(); }
+    bool operator==(iterator const &rhs) const noexcept {
+      return ptr_node == rhs.ptr_node && index == rhs.index;
+    }
+    bool operator!=(iterator const &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+    iterator &operator++() noexcept {
+      if (++index >= ptr_node->count) {
+        ptr_node = ptr_node->ptr_next;
+        index = 0;
+      }
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      auto iter = *this;
+      ++*this;
+      return iter;
+    }
+  };  // iterator
+  class const_iterator : public iterator {
+    friend unrolled_forward_list;
+   public:
+    using reference = typename unrolled_forward_list::const_reference;
+    using pointer = typename unrolled_forward_list::const_pointer;
+    const_iterator() noexcept = default;
+    const_iterator(NodeBase *ptr_node, size_type index) noexcept
+        : iterator(ptr_node, index) { }
+    reference operator*() const noexcept { return this->iterator::operator*(); }
+    pointer operator->() const noexcept { return this->iterator::operator->(); }
+  };  // const_iterator
+  // range related methods:
+  iterator before_begin() noexcept { return iterator(before_head(), 0); }
+  const_iterator before_begin() const noexcept { return cbefore_begin(); }
+  const_iterator cbefore_begin() const noexcept {
+    return const_iterator(before_head(), 0);
+  }
+  iterator begin() noexcept { return iterator(head_.ptr_next, 0); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(head_.ptr_next, 0);
+  }
+  iterator end() noexcept { return iterator(nullptr, 0); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(nullptr, 0); }
+
+ public:  // operations at the beginning:
+  template <class... Args>
+  void emplace_front(Args&&... args) {
+    emplace_after(before_begin(), abc::forward<Args>(args)...);
+  }
+  void push_front(const T &value) { emplace_front(value); }
+  void push_front(T &&value) { emplace_front(abc::move(value)); }
+  void pop_front() noexcept { erase_after(before_begin()); }
+
+ public:  // operations after a given position:
+  // Construct a new element after `iter`, and return an iterator to it.
+  // Nothing is changed if the construction throws.
+  template <class... Args>
+  iterator emplace_after(iterator iter, Args&&... args) {
+    // `args` might refer to an element, which is shifted or split away, so
+    // construct the new one aside before moving anything:
+    auto value = T(abc::forward<Args>(args)...);
+    std::pair<Node *, size_type> position;
+    if (iter.ptr_node == before_head()) {
+      auto ptr_first = head_.ptr_next;
+      if (!ptr_first) {
+        ptr_first = new_node_after(before_head());
+      }
+      position = insert_at(ptr_first, 0, abc::move(value));
+    } else {
+      position = insert_at(static_cast<Node *>(iter.ptr_node),
+                           iter.index + 1, abc::move(value));
+    }
+    return iterator(position.first, position.second);
+  }
+  iterator insert_after(iterator iter, const T &value) {
+    return emplace_after(iter, value);
+  }
+  iterator insert_after(iterator iter, T &&value) {
+    return emplace_after(iter, abc::move(value));
+  }
+  // Insert copies of [first, last) after `iter`, and return the last one.
+  // If one throws, those inserted before it are kept.
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  iterator insert_after(iterator iter, InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      iter = emplace_after(iter, *first);
+    }
+    return iter;
+  }
+  iterator insert_after(iterator iter, size_type count, const T &value) {
+    while (count--) {
+      iter = emplace_after(iter, value);
+    }
+    return iter;
+  }
+  iterator insert_after(iterator iter, std::initializer_list<T> init) {
+    return insert_after(iter, init.begin(), init.end());
+  }
+  // Erase the element after `iter`, and return the one after the erased.
+  iterator erase_after(iterator iter) noexcept {
+    Node *ptr_node;
+    size_type i;
+    if (iter.index + 1 < iter.ptr_node->count) {
+      ptr_node = static_cast<Node *>(iter.ptr_node);
+      i = iter.index + 1;
+    } else {
+      ptr_node = iter.ptr_node->ptr_next;
+      i = 0;
+    }
+    auto data = ptr_node->data();
+    node_alloc_traits::destroy(node_allocator(), data + i);
+    record(stat::kDestructions);
+    relocate_n(data + i + 1, --ptr_node->count - i, data + i);
+    if (ptr_node->count == 0) {
+      // Only the first element of a node is erased by its predecessor:
+      delete_after(iter.ptr_node);
+      return iterator(iter.ptr_node->ptr_next, 0);
+    }
+    rebalance(ptr_node);
+    return i < ptr_node->count ? iterator(ptr_node, i)
+                               : iterator(ptr_node->ptr_next, 0);
+  }
+  // Erase the elements in (first, last), and return `last`.
+  iterator erase_after(iterator first, iterator last) noexcept {
+    // `last` may be moved by erasing, but the number to erase stays:
+    auto next = first;
+    for (auto n = std::distance(++next, last); n; --n) {
+      erase_after(first);
+    }
+    next = first;
+    return ++next;
+  }
+};  // unrolled_forward_list
+
+template <class T, std::size_t K, class Allocator>
+bool operator==(const unrolled_forward_list<T, K, Allocator> &lhs,
+                const unrolled_forward_list<T, K, Allocator> &rhs) noexcept {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class T, std::size_t K, class Allocator>
+bool operator!=(const unrolled_forward_list<T, K, Allocator> &lhs,
+                const unrolled_forward_list<T, K, Allocator> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace abc
+
+#endif  // ABC_UNROLLED_FORWARD_LIST_H_
@@ -2,6 +2,10 @@
 #ifndef ABC_UTILITY_H_
 #define ABC_UTILITY_H_
 
+#include <cerrno>
+#include <system_error>
+#include <type_traits>
+
 #include "abc/type_traits.h"
 
 namespace abc {
@@ -16,6 +20,39 @@ T&& forward(remove_reference_t<T>&  t) { return static_cast<T&&>(t); } // NOLINT
 template <class T>
 T&& forward(remove_reference_t<T>&& t) { return static_cast<T&&>(t); } // NOLINT
 
+// Hold a `T` as a private base, so that an empty `T` (e.g. a stateless
+// allocator) takes no space in the derived class (Empty Base Optimization).
+// Use different `I`s to hold several objects of the same type.
+template <class T, int I = 0,
+          bool = std::is_empty_v<T> && !std::is_final_v<T>>
+class ebo_storage : private T {
+ public:
+  ebo_storage() = default;
+  explicit ebo_storage(const T &t) : T(t) {}
+  explicit ebo_storage(T &&t) : T(abc::forward<T>(t)) {}  // NOLINT
+  T &get() noexcept { return *this; }
+  const T &get() const noexcept { return *this; }
+};
+template <class T, int I>
+class ebo_storage<T, I, false> {
+  T value_;
+ public:
+  ebo_storage() = default;
+  explicit ebo_storage(const T &t) : value_(t) {}
+  explicit ebo_storage(T &&t) : value_(abc::forward<T>(t)) {}  // NOLINT
+  T &get() noexcept { return value_; }
+  const T &get() const noexcept { return value_; }
+};
+
+namespace internal {
+
+// Throw the error of the last failed system call, e.g. `open` or `write`.
+[[noreturn]] inline void throw_errno(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace internal
+
 }  // namespace abc
 
 #endif  // ABC_UTILITY_H_
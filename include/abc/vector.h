@@ -3,96 +3,280 @@
 #define ABC_VECTOR_H_
 
 #include <algorithm>
-#include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "abc/algorithm.h"
 #include "abc/iterator.h"
+#include "abc/stats.h"
+#include "abc/type_traits.h"
 #include "abc/utility.h"
 
 namespace abc {
 
-template <class T, class Allocator = std::allocator<T>>
-class vector {
+// How an abc::vector grows and shrinks its capacity.
+//
+// A full vector grows by the factor `kNumerator / kDenominator`, e.g. 3/2
+// allows the allocator to reuse the blocks freed by earlier growth.
+// Once `pop_back()` drops the size to `1 / kShrinkDivisor` of the capacity,
+// the capacity is shrunk to twice the size, which leaves room to oscillate
+// without reallocating.  A `kShrinkDivisor` of 0 disables shrinking.
+template <std::size_t kNumerator = 2, std::size_t kDenominator = 1,
+          std::size_t kShrinkDivisor = 4>
+struct growth_policy {
+  static_assert(kNumerator > kDenominator && kDenominator > 0,
+                "A vector must grow.");
+  static_assert(kShrinkDivisor == 0 || kShrinkDivisor > 2,
+                "Shrinking to twice the size needs a larger divisor.");
+
+  // Return the new capacity of a vector of `size` that needs `count` slots.
+  static constexpr std::size_t grow(std::size_t size, std::size_t count) {
+    return std::max({size * kNumerator / kDenominator, size + 1, count});
+  }
+  // Return the new capacity after the size has dropped to `size`.
+  static constexpr std::size_t shrink(std::size_t capacity,
+                                      std::size_t size) {
+    if (kShrinkDivisor && size && size * kShrinkDivisor <= capacity) {
+      return size * 2;
+    }
+    return capacity;
+  }
+};
+// Never give memory back until `shrink_to_fit()` is called.
+template <std::size_t kNumerator = 2, std::size_t kDenominator = 1>
+using no_shrink_growth_policy = growth_policy<kNumerator, kDenominator, 0>;
+
+namespace internal {
+
+// Uninitialized room for `N` elements inside a vector object.
+template <class T, std::size_t N>
+class inline_storage {
+ public:
+  T *data() noexcept { return reinterpret_cast<T *>(bytes_); }
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(bytes_);
+  }
+
+ private:
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+};
+template <class T>
+class inline_storage<T, 0> {
+ public:
+  T *data() const noexcept { return nullptr; }
+};
+
+// Whether `Allocator` can resize a block by `reallocate(p, old_n, new_n)`,
+// e.g. abc::mmap_allocator.
+template <class Allocator, class = void>
+struct can_reallocate : std::false_type {};
+template <class Allocator>
+struct can_reallocate<Allocator, std::void_t<decltype(
+    std::declval<Allocator &>().reallocate(
+        std::declval<typename Allocator::value_type *>(),
+        std::size_t(), std::size_t()))>> : std::true_type {};
+
+}  // namespace internal
+
+// A vector holding up to `kInlineCapacity` elements without allocation.
+// It is 0 for an ordinary vector, see abc::small_vector for the others.
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = abc::growth_policy<>,
+          std::size_t kInlineCapacity = 0>
+class vector : private abc::ebo_storage<Allocator>,
+               private internal::inline_storage<T, kInlineCapacity> {
  public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy_type = GrowthPolicy;
   using size_type = std::size_t;
   using reference = T &;
   using const_reference = const T &;
   using pointer = T *;
   using const_pointer = const T *;
 
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using allocator_base = abc::ebo_storage<Allocator>;
+  using inline_base = internal::inline_storage<T, kInlineCapacity>;
+  // Whether taking the elements of another vector cannot throw, which only
+  // moving inline elements one by one may do.
+  static constexpr bool kNothrowSteal = kInlineCapacity == 0 ||
+      abc::is_trivially_relocatable_v<T> ||
+      std::is_nothrow_move_constructible_v<T>;
+  // The allocator is held by `allocator_base`, which takes no space if empty.
+  Allocator &allocator() noexcept { return allocator_base::get(); }
+  const Allocator &allocator() const noexcept {
+    return allocator_base::get();
+  }
+  // The inline storage (`nullptr` if there is none) is used whenever it fits.
+  T *inline_data() noexcept { return inline_base::data(); }
+  bool is_inline() const noexcept {
+    return kInlineCapacity && array_ == inline_base::data();
+  }
+  T *allocate(size_type n) {
+    if (n <= kInlineCapacity) {
+      return inline_data();
+    }
+    record(stat::kAllocations);
+    return alloc_traits::allocate(allocator(), n);
+  }
+  void deallocate(T *p, size_type n) noexcept {
+    if (p != inline_data()) {
+      record(stat::kDeallocations);
+      alloc_traits::deallocate(allocator(), p, n);
+    }
+  }
+  // A heap block may be resized in place, if the allocator supports it and
+  // the elements may be moved by bytes.
+  static constexpr bool kReallocateInPlace =
+      internal::can_reallocate<Allocator>::value &&
+      abc::is_trivially_relocatable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>;
+  bool can_reallocate_in_place() const noexcept {
+    return kReallocateInPlace && capacity_ > kInlineCapacity;
+  }
+  void reallocate_in_place(size_type new_capacity) {
+    if constexpr (kReallocateInPlace) {
+      array_ = allocator().reallocate(array_, capacity_, new_capacity);
+      capacity_ = new_capacity;
+      record(stat::kReallocations);
+    }
+  }
+  // Count an operation of this type, if ABC_ENABLE_STATS is defined.
+  static void record(stat s, size_type n = 1) noexcept {
+    internal::count<vector>(s, n);
+  }
+  // Take the elements of `that`, which is left empty and inline.
+  void steal(vector *that) noexcept(kNothrowSteal) {
+    if (that->is_inline()) {
+      array_ = inline_data();
+      capacity_ = kInlineCapacity;
+      relocate(that->begin(), that->end(), array_);
+    } else {
+      array_ = that->array_;
+      capacity_ = that->capacity_;
+    }
+    size_ = that->size_;
+    that->size_ = 0;
+    that->capacity_ = kInlineCapacity;
+    that->array_ = that->inline_data();
+  }
+
  public:
   // construction
   vector() = default;
-  explicit vector(size_type count, const T &value = T())
-      : capacity_(count), size_(count), array_(allocator_.allocate(count)) {
+  explicit vector(const Allocator &alloc) : allocator_base(alloc) {}
+  explicit vector(size_type count, const T &value = T(),
+                  const Allocator &alloc = Allocator())
+      : allocator_base(alloc), capacity_(std::max(count, kInlineCapacity)),
+        size_(count), array_(allocate(capacity_)) {
     std::uninitialized_fill_n(array_, size_, value);
+    record(stat::kCopies, size_);
   }
-  template<class InputIt>
-  vector(InputIt first, InputIt last)
-      : capacity_(last - first), size_(capacity_),
-        array_(allocator_.allocate(capacity_)) {
-    std::uninitialized_copy(first, last, array_);
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+      : allocator_base(alloc) {
+    insert(end(), first, last);
   }
-  vector(std::initializer_list<T> init) : vector(init.begin(), init.end()) {}
+  vector(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+      : vector(init.begin(), init.end(), alloc) {}
   vector &operator=(std::initializer_list<T> init) {
-    clear();
-    size_ = init.end() - init.begin();
-    if (size_ > capacity_) {
-      allocator_.deallocate(array_, capacity_);
-      capacity_ = size_;
-      array_ = allocator_.allocate(capacity_);
-    }
-    std::uninitialized_copy(init.begin(), init.end(), array_);
+    assign(init.begin(), init.end());
     return *this;
   }
   // destruction
   ~vector() noexcept {
     clear();
-    allocator_.deallocate(array_, capacity_);
+    deallocate(array_, capacity_);
   }
   // copy operations:
-  vector(const vector &that) { *this = that; }
+  vector(const vector &that)
+      : allocator_base(alloc_traits::select_on_container_copy_construction(
+            that.allocator())),
+        capacity_(that.capacity()), size_(that.size()),
+        array_(allocate(capacity_)) {
+    std::uninitialized_copy(that.begin(), that.end(), array_);
+    record(stat::kCopies, size_);
+  }
   vector &operator=(const vector &that) {
     if (this != &that) {
       clear();
+      if constexpr (
+          alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (allocator() != that.allocator()) {
+          // return the memory to the allocator that has allocated it:
+          deallocate(array_, capacity_);
+          allocator() = that.allocator();
+          capacity_ = that.capacity();
+          array_ = allocate(capacity_);
+        }
+      }
       if (capacity_ != that.capacity()) {
-        allocator_.deallocate(array_, capacity_);
+        deallocate(array_, capacity_);
         capacity_ = that.capacity();
+        array_ = allocate(capacity_);
       }
       size_ = that.size();
       std::uninitialized_copy(that.begin(), that.end(), array_);
+      record(stat::kCopies, size_);
     }
     return *this;
   }
   // move operations:
-  vector(vector &&that) noexcept {
-    *this = abc::move(that);
+  vector(vector &&that) noexcept(kNothrowSteal)
+      : allocator_base(abc::move(that.allocator())) {
+    steal(&that);
   }
-  vector &operator=(vector &&that) noexcept {
+  vector &operator=(vector &&that) noexcept(kNothrowSteal && (
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value)) {
     if (this != &that) {
+      if constexpr (
+          !alloc_traits::propagate_on_container_move_assignment::value &&
+          !alloc_traits::is_always_equal::value) {
+        if (allocator() != that.allocator()) {
+          // cannot steal memory from another allocator, so move one by one:
+          clear();
+          if (capacity_ < that.size()) {
+            // allocate first, so a throw leaves `array_` valid:
+            auto new_array = allocate(that.size());
+            deallocate(array_, capacity_);
+            array_ = new_array;
+            capacity_ = that.size();
+          }
+          std::uninitialized_move(that.begin(), that.end(), array_);
+          size_ = that.size();
+          record(stat::kMoves, size_);
+          that.clear();
+          return *this;
+        }
+      }
       // clean this:
       clear();
-      allocator_.deallocate(array_, capacity_);
-      // steal members from that:
-      size_ = that.size();
-      that.size_ = 0;
-      capacity_ = that.capacity();
-      that.capacity_ = 0;
-      array_ = that.array_;
-      that.array_ = allocator_.allocate(0);
+      deallocate(array_, capacity_);
+      if constexpr (
+          alloc_traits::propagate_on_container_move_assignment::value) {
+        allocator() = abc::move(that.allocator());
+      }
+      steal(&that);
     }
     return *this;
   }
+  allocator_type get_allocator() const noexcept { return allocator(); }
 
  private:  // Data members:
   // Don't change the order of these members!
-  size_type capacity_{0};
+  size_type capacity_{kInlineCapacity};
   size_type size_{0};
-  T *array_{allocator_.allocate(0)};
-  static Allocator allocator_;
+  T *array_{inline_data()};
 
  public:
   // iterator and related methods
@@ -115,6 +299,8 @@ class vector {
   }
   size_type size() const noexcept { return size_; }
   size_type capacity() const noexcept { return capacity_; }
+  T *data() noexcept { return array_; }
+  const T *data() const noexcept { return array_; }
   // element accessors (without check)
   reference operator[] (size_type pos) { return array_[pos]; }
   const_reference operator[] (size_type pos) const { return array_[pos]; }
@@ -135,110 +321,390 @@ class vector {
     }
     return array_[pos];
   }
+  // capacity methods
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      reallocate(new_capacity);
+    }
+  }
+  void shrink_to_fit() {
+    if (capacity_ > size_) {
+      reallocate(size_);
+    }
+  }
   // modifying methods
   void resize(size_type count, const T &value = T()) {
     if (count > capacity_) {
-      auto new_capacity = capacity_;
-      while (new_capacity < count) { new_capacity *= 2; }
-      auto new_array = allocator_.allocate(new_capacity);
-      auto p = std::uninitialized_move(begin(), end(), new_array);
-      std::uninitialized_fill_n(p, count - size_, value);
-      allocator_.deallocate(array_, capacity_);
+      auto new_capacity = GrowthPolicy::grow(size_, count);
+      if constexpr (kReallocateInPlace) {
+        if (capacity_ > kInlineCapacity) {
+          auto copy = value;  // `value` might refer to an element
+          reallocate_in_place(new_capacity);
+          std::uninitialized_fill_n(end(), count - size_, copy);
+          record(stat::kCopies, count - size_);
+          size_ = count;
+          return;
+        }
+      }
+      auto new_array = allocate(new_capacity);
+      // `value` might refer to an element, so fill before relocating:
+      std::uninitialized_fill_n(new_array + size_, count - size_, value);
+      record(stat::kCopies, count - size_);
+      record(stat::kReallocations);
+      relocate(begin(), end(), new_array);
+      deallocate(array_, capacity_);
       array_ = new_array;
       capacity_ = new_capacity;
     } else if (count > size_) {
       std::uninitialized_fill_n(end(), count - size_, value);
+      record(stat::kCopies, count - size_);
+    } else {
+      destroy(begin() + count, end());
     }
     size_ = count;
   }
+  // Resize to `count` elements, leaving those past `size()` unconstructed
+  // for `op(data(), count)` to write, which returns the final size, as
+  // std::basic_string::resize_and_overwrite of C++23.  Each element is thus
+  // written once, e.g. by reading it from a file.
+  template <class Operation>
+  void resize_and_overwrite(size_type count, Operation op) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only bytes written in place make an element.");
+    if (count > capacity_) {
+      reserve(GrowthPolicy::grow(size_, count));
+    }
+    size_ = op(array_, count);
+  }
   template <class... Args>
-  void emplace_back(Args&&... args) {
+  reference emplace_back(Args&&... args) {
     if (size() == capacity()) {
-      enlarge();
+      return emplace_back_slow(std::forward<Args>(args)...);
     }
-    assert(size() < capacity());
-    allocator_.construct(array_ + size_++, std::forward<Args>(args)...);
+    alloc_traits::construct(allocator(), array_ + size_,
+                            std::forward<Args>(args)...);
+    internal::count_construction<vector, T, Args...>();
+    return array_[size_++];
   }
-  void push_back(const T &value) {
-    if (size() == capacity()) {
-      enlarge();
+  void push_back(const T &value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+  void pop_back() {
+    alloc_traits::destroy(allocator(), array_ + --size_);
+    record(stat::kDestructions);
+    auto new_capacity = GrowthPolicy::shrink(capacity_, size_);
+    if (new_capacity < capacity_) {
+      reallocate(new_capacity);
     }
-    assert(size() < capacity());
-    allocator_.construct(array_ + size_++, value);
   }
-  void push_back(T &&value) {
-    if (size() == capacity()) {
-      enlarge();
+  void clear() noexcept {
+    destroy(begin(), end());
+    size_ = 0;
+  }
+  // bulk modifying methods, each of which reallocates at most once
+  void assign(size_type count, const T &value) {
+    if (count > capacity_) {
+      // `value` might refer to an element, so fill before clearing:
+      auto new_array = allocate(count);
+      std::uninitialized_fill_n(new_array, count, value);
+      replace_array(new_array, count, count);
+    } else {
+      auto n = std::min(count, size_);
+      std::fill_n(begin(), n, value);
+      resize(count, value);
     }
-    assert(size() < capacity());
-    allocator_.construct(array_ + size_++, std::move(value));
   }
-  void pop_back() {
-    --size_;
-    if (size_ > 0 && size_ <= capacity_/4) {
-      shrink();
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  void assign(InputIt first, InputIt last) {
+    if constexpr (abc::is_forward_iterator_v<InputIt>) {
+      auto count = static_cast<size_type>(std::distance(first, last));
+      if (count > capacity_) {
+        auto new_array = allocate(count);
+        std::uninitialized_copy(first, last, new_array);
+        replace_array(new_array, count, count);
+      } else if (count > size_) {
+        auto mid = std::next(first, size_);
+        std::copy(first, mid, begin());
+        std::uninitialized_copy(mid, last, end());
+        size_ = count;
+      } else {
+        destroy(std::copy(first, last, begin()), end());
+        size_ = count;
+      }
+      record(stat::kCopies, count);
+    } else {
+      clear();
+      insert(end(), first, last);
     }
   }
-  void clear() noexcept {
-    for (int i = 0; i < size_; i++) {
-      allocator_.destroy(array_ + i);
+  void assign(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+  }
+  iterator insert(const_iterator pos, const T &value) {
+    return insert(pos, 1, value);
+  }
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    // `args` might refer to an element, so construct the new one aside:
+    auto value = T(std::forward<Args>(args)...);
+    return insert_n(pos - cbegin(), 1, [this, &value](T *gap) {
+      alloc_traits::construct(allocator(), gap, std::move(value));
+    });
+  }
+  iterator insert(const_iterator pos, size_type count, const T &value) {
+    if (count == 0) {
+      return begin() + (pos - cbegin());
     }
-    size_ = 0;
+    // `value` might refer to an element, which might be moved:
+    auto copy = value;
+    record(stat::kCopies, count);
+    return insert_n(pos - cbegin(), count, [count, &copy](T *gap) {
+      std::uninitialized_fill_n(gap, count, copy);
+    });
+  }
+  // Insert copies of [first, last), which must not refer to this vector.
+  template <class InputIt,
+            class = std::enable_if_t<abc::is_iterator_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    auto index = pos - cbegin();
+    if constexpr (abc::is_forward_iterator_v<InputIt>) {
+      auto count = static_cast<size_type>(std::distance(first, last));
+      record(stat::kCopies, count);
+      return insert_n(index, count, [first, last](T *gap) {
+        std::uninitialized_copy(first, last, gap);
+      });
+    } else {
+      // the length is unknown, so append and then rotate into place:
+      auto old_size = size_;
+      for (; first != last; ++first) {
+        emplace_back(*first);
+      }
+      std::rotate(begin() + index, begin() + old_size, end());
+      return begin() + index;
+    }
+  }
+  iterator insert(const_iterator pos, std::initializer_list<T> init) {
+    return insert(pos, init.begin(), init.end());
+  }
+  template <class Range>
+  void append_range(Range &&range) {
+    insert(end(), std::begin(range), std::end(range));
   }
-  void swap(vector &other) noexcept {
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+  // Destroy [first, last) and move the tail forward.
+  iterator erase(const_iterator first, const_iterator last) {
+    auto gap = begin() + (first - cbegin());
+    auto count = last - first;
+    if (count) {
+      destroy(gap, gap + count);
+      shift(gap + count, end(), gap);
+      size_ -= count;
+    }
+    return gap;
+  }
+  void swap(vector &other) noexcept(kNothrowSteal) {
+    if constexpr (kInlineCapacity > 0) {
+      if (is_inline() || other.is_inline()) {
+        // inline elements cannot change hands, so move them:
+        auto temp = abc::move(other);
+        other = abc::move(*this);
+        *this = abc::move(temp);
+        return;
+      }
+    }
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(allocator(), other.allocator());
+    }
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
     std::swap(array_, other.array_);
   }
 
  private:
-  void enlarge() {
-    auto new_capacity = capacity_;
-    if (size_ == 0) {
-      new_capacity = 1;
-    } else {
-      new_capacity = size_ * 2;
+  // Grow a full vector, constructing the new element before relocating the
+  // old ones, since `args` might refer to one of them.
+  template <class... Args>
+  reference emplace_back_slow(Args&&... args) {
+    auto new_capacity = GrowthPolicy::grow(size_, size_ + 1);
+    if constexpr (kReallocateInPlace) {
+      if (capacity_ > kInlineCapacity) {
+        auto value = T(std::forward<Args>(args)...);
+        reallocate_in_place(new_capacity);
+        alloc_traits::construct(allocator(), array_ + size_, std::move(value));
+        internal::count_construction<vector, T, Args...>();
+        return array_[size_++];
+      }
+    }
+    auto new_array = allocate(new_capacity);
+    try {
+      alloc_traits::construct(allocator(), new_array + size_,
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(new_array, new_capacity);
+      throw;
+    }
+    internal::count_construction<vector, T, Args...>();
+    record(stat::kReallocations);
+    relocate(begin(), end(), new_array);
+    deallocate(array_, capacity_);
+    array_ = new_array;
+    capacity_ = new_capacity;
+    return array_[size_++];
+  }
+  // Construct `count` elements at `index` by `construct(gap)`, which either
+  // constructs all of them or throws.  The tail is moved, at most once.
+  template <class Construct>
+  iterator insert_n(size_type index, size_type count, Construct &&construct) {
+    if (size_ + count > capacity_) {
+      auto new_capacity = GrowthPolicy::grow(size_, size_ + count);
+      if (can_reallocate_in_place()) {
+        reallocate_in_place(new_capacity);
+      } else {
+        auto first = begin(), last = end();
+        auto new_array = allocate(new_capacity);
+        try {
+          construct(new_array + index);
+        } catch (...) {
+          deallocate(new_array, new_capacity);
+          throw;
+        }
+        record(stat::kReallocations);
+        relocate(first, first + index, new_array);
+        relocate(first + index, last, new_array + index + count);
+        deallocate(array_, capacity_);
+        array_ = new_array;
+        capacity_ = new_capacity;
+        size_ += count;
+        return begin() + index;
+      }
     }
-    auto new_array = allocator_.allocate(new_capacity);
-    std::uninitialized_move(begin(), end(), new_array);
-    allocator_.deallocate(array_, capacity_);
+    auto gap = begin() + index;
+    shift(gap, end(), gap + count);
+    try {
+      construct(gap);
+    } catch (...) {
+      shift(gap + count, end() + count, gap);
+      throw;
+    }
+    size_ += count;
+    return gap;
+  }
+  // Destroy the elements and replace the array by a new one.
+  void replace_array(T *new_array, size_type new_size,
+                     size_type new_capacity) noexcept {
+    destroy(begin(), end());
+    deallocate(array_, capacity_);
     array_ = new_array;
+    size_ = new_size;
     capacity_ = new_capacity;
   }
-  void shrink() {
-    auto new_capacity = capacity_;
-    new_capacity /= 2;
-    auto new_array = allocator_.allocate(new_capacity);
-    std::uninitialized_move(begin(), end(), new_array);
-    allocator_.deallocate(array_, capacity_);
+  void destroy(T *first, T *last) noexcept {
+    record(stat::kDestructions, last - first);
+    for (; first != last; ++first) {
+      alloc_traits::destroy(allocator(), first);
+    }
+  }
+  void reallocate(size_type new_capacity) {
+    new_capacity = std::max(new_capacity, kInlineCapacity);
+    if (new_capacity == capacity_) {
+      return;
+    }
+    if constexpr (kReallocateInPlace) {
+      if (capacity_ > kInlineCapacity && new_capacity > kInlineCapacity) {
+        reallocate_in_place(new_capacity);
+        return;
+      }
+    }
+    auto new_array = allocate(new_capacity);
+    record(stat::kReallocations);
+    relocate(begin(), end(), new_array);
+    deallocate(array_, capacity_);
     array_ = new_array;
     capacity_ = new_capacity;
   }
-};
-// static member
-template <class T, class Allocator>
-Allocator vector<T, Allocator>::allocator_;  // NOLINT
-
-}  // namespace abc
-
-template <class T, class Allocator>
-bool operator==(const abc::vector<T, Allocator> &lhs,
-                const abc::vector<T, Allocator> &rhs) noexcept {
-  auto iter = lhs.begin();
-  const auto iend = lhs.end();
-  for (const auto &x : rhs) {
-    if (iter == iend || *iter != x) {
-      return false;
+  // Relocate [first, last) to `d_first` in the same array, which may overlap.
+  static void shift(T *first, T *last, T *d_first) {
+    if (first == last || first == d_first) {
+      return;
+    }
+    record(stat::kBytesRelocated, (last - first) * sizeof(T));
+    if constexpr (abc::is_trivially_relocatable_v<T>) {
+      std::memmove(static_cast<void *>(d_first),
+                   static_cast<const void *>(first),
+                   (last - first) * sizeof(T));
+    } else {
+      record(stat::kMoves, last - first);
+      record(stat::kDestructions, last - first);
+      if (d_first < first) {
+        for (; first != last; ++first, ++d_first) {
+          ::new (static_cast<void *>(d_first)) T(std::move(*first));
+          first->~T();
+        }
+      } else {
+        auto d_last = d_first + (last - first);
+        while (first != last) {
+          ::new (static_cast<void *>(--d_last)) T(std::move(*--last));
+          last->~T();
+        }
+      }
+    }
+  }
+  // Move [first, last) to uninitialized memory and end their lifetimes.
+  static void relocate(T *first, T *last, T *d_first) {
+    record(stat::kBytesRelocated, (last - first) * sizeof(T));
+    if constexpr (abc::is_trivially_relocatable_v<T>) {
+      if (first != last) {
+        std::memcpy(static_cast<void *>(d_first),
+                    static_cast<const void *>(first),
+                    (last - first) * sizeof(T));
+      }
     } else {
-      ++iter;
+      std::uninitialized_move(first, last, d_first);
+      std::destroy(first, last);
+      record(stat::kMoves, last - first);
+      record(stat::kDestructions, last - first);
     }
   }
-  return iter == iend;
+};
+// Vectors of different sizes are unequal at once, and vectors of integers or
+// floating-point numbers are compared by the kernels in "abc/simd.h".
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator==(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+                const abc::vector<T, Allocator, GrowthPolicy, N> &rhs)
+    noexcept {
+  return abc::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
-template <class T, class Allocator>
-bool operator!=(const abc::vector<T, Allocator> &lhs,
-                const abc::vector<T, Allocator> &rhs) noexcept {
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator!=(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+                const abc::vector<T, Allocator, GrowthPolicy, N> &rhs)
+    noexcept {
   return !(lhs == rhs);
 }
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator<(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+               const abc::vector<T, Allocator, GrowthPolicy, N> &rhs) {
+  return abc::lexicographical_compare(lhs.begin(), lhs.end(),
+                                      rhs.begin(), rhs.end());
+}
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator>(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+               const abc::vector<T, Allocator, GrowthPolicy, N> &rhs) {
+  return rhs < lhs;
+}
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator<=(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+                const abc::vector<T, Allocator, GrowthPolicy, N> &rhs) {
+  return !(rhs < lhs);
+}
+template <class T, class Allocator, class GrowthPolicy, std::size_t N>
+bool operator>=(const abc::vector<T, Allocator, GrowthPolicy, N> &lhs,
+                const abc::vector<T, Allocator, GrowthPolicy, N> &rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace abc
 
 #endif  // ABC_VECTOR_H_
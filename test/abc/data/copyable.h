@@ -29,6 +29,7 @@ class Copyable : public DefaultConstructableButSlow {
   // Comparing operations:
   bool operator==(const Copyable& that) const { return Id() == that.Id(); }
   bool operator!=(const Copyable& that) const { return !operator==(that); }
+  bool operator<(const Copyable& that) const { return Id() < that.Id(); }
 };  // class Copyable
 
 }  // namespace data
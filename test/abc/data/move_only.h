@@ -4,8 +4,10 @@
 #define TEST_ABC_DATA_MOVE_ONLY_H_
 
 #include <memory>
+#include <type_traits>
 
 #include "abc/data/default_constructable_but_slow.h"
+#include "abc/type_traits.h"
 
 namespace abc {
 namespace data {
@@ -34,6 +36,11 @@ class MoveOnly : public DefaultConstructableButSlow {
 };  // class MoveOnly
 
 }  // namespace data
+
+// `MoveOnly` only holds a `std::unique_ptr`, so it can be relocated by bytes:
+template <>
+struct is_trivially_relocatable<data::MoveOnly> : std::true_type {};
+
 }  // namespace abc
 
 #endif  // TEST_ABC_DATA_MOVE_ONLY_H_
@@ -0,0 +1,59 @@
+// Copyright 2026 Weicheng Pei
+
+#ifndef TEST_ABC_DATA_STATEFUL_ALLOCATOR_H_
+#define TEST_ABC_DATA_STATEFUL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace abc {
+namespace data {
+
+// An allocator counting the bytes in use, which is shared by its copies.
+// Two allocators are equal if and only if they share the same counter.
+template <class T>
+class StatefulAllocator {
+  template <class U> friend class StatefulAllocator;
+  std::shared_ptr<std::size_t> bytes_{std::make_shared<std::size_t>(0)};
+
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+  // Constructors:
+  StatefulAllocator() = default;
+  // A moved-from allocator must still be equal to the moved-to one:
+  StatefulAllocator(const StatefulAllocator &) = default;
+  StatefulAllocator &operator=(const StatefulAllocator &) = default;
+  template <class U>
+  StatefulAllocator(const StatefulAllocator<U> &that)  // NOLINT
+      : bytes_(that.bytes_) {}
+  // Accessor:
+  std::size_t Bytes() const { return *bytes_; }
+  // Allocator methods:
+  T *allocate(std::size_t n) {
+    *bytes_ += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    *bytes_ -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+  // Comparing operations:
+  template <class U>
+  bool operator==(const StatefulAllocator<U> &that) const {
+    return bytes_ == that.bytes_;
+  }
+  template <class U>
+  bool operator!=(const StatefulAllocator<U> &that) const {
+    return !operator==(that);
+  }
+};  // class StatefulAllocator
+
+}  // namespace data
+}  // namespace abc
+
+#endif  // TEST_ABC_DATA_STATEFUL_ALLOCATOR_H_
@@ -0,0 +1,217 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/algorithm.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/simd.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+template <class T>
+class TestKernels : public ::testing::Test {
+ protected:
+  // Every kernel supported by the CPU, which must agree with `scalar`.
+  struct Kernels {
+    const T *(*find)(const T *, const T *, T);
+    std::size_t (*count)(const T *, const T *, T);
+    std::size_t (*mismatch)(const T *, const T *, std::size_t);
+  };
+  static std::vector<Kernels> AllKernels() {
+    auto kernels = std::vector<Kernels>{
+        {abc::simd::scalar::find<T>, abc::simd::scalar::count<T>,
+         abc::simd::scalar::mismatch<T>},
+        {abc::simd::find<T>, abc::simd::count<T>, abc::simd::mismatch<T>}};
+#ifdef ABC_SIMD_X86
+    kernels.push_back({abc::simd::sse2::find<T>, abc::simd::sse2::count<T>,
+                       abc::simd::sse2::mismatch<T>});
+    if (abc::simd::has_avx2()) {
+      kernels.push_back({abc::simd::avx2::find<T>, abc::simd::avx2::count<T>,
+                         abc::simd::avx2::mismatch<T>});
+    }
+#endif
+    return kernels;
+  }
+  // Longer than a few registers of any width, with a tail.
+  static constexpr int kSize = 100;
+  std::vector<T> data_ = [] {
+    auto data = std::vector<T>(kSize);
+    for (int i = 0; i != kSize; ++i) {
+      data[i] = static_cast<T>(i % 7);
+    }
+    return data;
+  }();
+};
+using ElementTypes = ::testing::Types<
+    int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t,
+    float, double>;
+TYPED_TEST_SUITE(TestKernels, ElementTypes);
+
+TYPED_TEST(TestKernels, Find) {
+  using T = TypeParam;
+  const auto &data = this->data_;
+  for (const auto &kernel : this->AllKernels()) {
+    for (int n = 0; n <= this->kSize; ++n) {
+      auto first = data.data(), last = first + n;
+      for (int x = 0; x != 8; ++x) {
+        EXPECT_EQ(kernel.find(first, last, T(x)),
+                  std::find(first, last, T(x)));
+      }
+    }
+  }
+}
+TYPED_TEST(TestKernels, Count) {
+  using T = TypeParam;
+  const auto &data = this->data_;
+  for (const auto &kernel : this->AllKernels()) {
+    for (int n = 0; n <= this->kSize; ++n) {
+      auto first = data.data(), last = first + n;
+      for (int x = 0; x != 8; ++x) {
+        EXPECT_EQ(kernel.count(first, last, T(x)),
+                  std::count(first, last, T(x)));
+      }
+    }
+  }
+}
+TYPED_TEST(TestKernels, Mismatch) {
+  using T = TypeParam;
+  for (const auto &kernel : this->AllKernels()) {
+    for (int i = 0; i <= this->kSize; ++i) {
+      auto other = this->data_;
+      if (i != this->kSize) {
+        other[i] = T(99);
+      }
+      for (int n = 0; n <= this->kSize; ++n) {
+        EXPECT_EQ(kernel.mismatch(this->data_.data(), other.data(), n),
+                  std::min(i, n));
+      }
+    }
+  }
+}
+TYPED_TEST(TestKernels, Extremes) {
+  // Lanes that only differ in their highest or lowest bits:
+  using T = TypeParam;
+  using Limits = std::numeric_limits<T>;
+  auto a = std::vector<T>(this->kSize, Limits::max());
+  auto b = a;
+  b.back() = Limits::lowest();
+  for (const auto &kernel : this->AllKernels()) {
+    EXPECT_EQ(kernel.mismatch(a.data(), b.data(), a.size()), a.size() - 1);
+    EXPECT_EQ(kernel.count(b.data(), b.data() + b.size(), Limits::max()),
+              b.size() - 1);
+    EXPECT_EQ(kernel.find(b.data(), b.data() + b.size(), Limits::lowest()),
+              &b.back());
+  }
+}
+TEST(TestAlgorithm, Popcount) {
+  using Popcount = std::size_t (*)(const std::uint64_t *, std::size_t);
+  auto kernels = std::vector<Popcount>{
+      abc::simd::scalar::popcount, abc::simd::popcount};
+#ifdef ABC_SIMD_X86
+  kernels.push_back(abc::simd::sse2::popcount);
+  if (abc::simd::has_avx2()) {
+    kernels.push_back(abc::simd::avx2::popcount);
+  }
+#endif
+  // Random words, then words of all ones, which fill each byte count:
+  auto engine = std::mt19937_64(2026);
+  auto words = std::vector<std::uint64_t>(300);
+  for (auto &word : words) {
+    word = engine();
+  }
+  auto ones = std::vector<std::uint64_t>(300, ~std::uint64_t(0));
+  for (auto kernel : kernels) {
+    std::size_t expected = 0;
+    for (std::size_t n = 0; n <= words.size(); ++n) {
+      ASSERT_EQ(kernel(words.data(), n), expected);
+      ASSERT_EQ(kernel(ones.data(), n), 64 * n);
+      if (n != words.size()) {
+        expected += std::bitset<64>(words[n]).count();
+      }
+    }
+  }
+}
+
+TEST(TestAlgorithm, FloatingPoint) {
+  // `NaN != NaN` and `0.0 == -0.0`, so bytes cannot be compared:
+  constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+  auto a = abc::vector<double>(64, 1.0), b = a;
+  a[10] = 0.0;
+  b[10] = -0.0;
+  EXPECT_EQ(a, b);
+  EXPECT_FALSE(a < b || b < a);
+  a[50] = b[50] = kNaN;
+  EXPECT_NE(a, b);
+  EXPECT_EQ(abc::mismatch(a.begin(), a.end(), b.begin()).first, &a[50]);
+  EXPECT_EQ(abc::find(a.begin(), a.end(), kNaN), a.end());
+  EXPECT_EQ(abc::count(a.begin(), a.end(), 0.0), 1);
+  // Unordered pairs are skipped, as `std::lexicographical_compare` does:
+  b[60] = 2.0;
+  EXPECT_TRUE(a < b);
+  EXPECT_EQ(a < b, std::lexicographical_compare(a.begin(), a.end(),
+                                                b.begin(), b.end()));
+}
+TEST(TestAlgorithm, MixedTypes) {
+  auto v = abc::vector<int64_t>{1, 2, 3, int64_t(1) << 40};
+  // An `int` is converted to an `int64_t`, so the kernels are used:
+  EXPECT_EQ(abc::find(v.begin(), v.end(), 3), v.begin() + 2);
+  EXPECT_EQ(abc::count(v.begin(), v.end(), 2), 1);
+  auto u = abc::vector<uint8_t>{0, 44, 255};
+  // Comparing with an `int` promotes each `uint8_t`, so `300` is not `44`:
+  EXPECT_EQ(abc::find(u.begin(), u.end(), 300), u.end());
+  EXPECT_EQ(abc::count(u.begin(), u.end(), -1), 0);
+}
+TEST(TestAlgorithm, OtherIterators) {
+  // Lists and non-arithmetic types fall back to `std`:
+  auto list = std::forward_list<int>{1, 2, 3, 2};
+  EXPECT_EQ(*abc::find(list.begin(), list.end(), 3), 3);
+  EXPECT_EQ(abc::count(list.begin(), list.end(), 2), 2);
+  auto kittens = abc::vector<abc::data::Copyable>();
+  for (int i = 0; i != 4; ++i) {
+    kittens.emplace_back(i);
+  }
+  auto copied = kittens;
+  EXPECT_TRUE(abc::equal(kittens.begin(), kittens.end(),
+                         copied.begin(), copied.end()));
+  EXPECT_EQ(abc::mismatch(kittens.begin(), kittens.end(),
+                          copied.begin(), copied.end() - 1).first,
+            kittens.end() - 1);
+  EXPECT_FALSE(abc::equal(kittens.begin(), kittens.end(),
+                          copied.begin(), copied.end() - 1));
+}
+TEST(TestAlgorithm, BinarySearch) {
+  // Every size up to 64, with duplicates, against every probe around them:
+  for (int n = 0; n != 64; ++n) {
+    auto v = abc::vector<int>(n);
+    for (int i = 0; i != n; ++i) {
+      v[i] = i / 3 * 2;
+    }
+    for (int x = -1; x <= n; ++x) {
+      EXPECT_EQ(abc::lower_bound(v.begin(), v.end(), x),
+                std::lower_bound(v.begin(), v.end(), x));
+      EXPECT_EQ(abc::upper_bound(v.begin(), v.end(), x),
+                std::upper_bound(v.begin(), v.end(), x));
+    }
+  }
+  auto v = abc::vector<int>{9, 7, 7, 3, 1};
+  EXPECT_EQ(abc::lower_bound(v.begin(), v.end(), 7, std::greater<>()),
+            v.begin() + 1);
+  EXPECT_EQ(abc::upper_bound(v.begin(), v.end(), 7, std::greater<>()),
+            v.begin() + 3);
+  auto list = std::forward_list<int>{1, 2, 2, 3};
+  EXPECT_EQ(std::distance(list.begin(),
+                          abc::upper_bound(list.begin(), list.end(), 2)), 3);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
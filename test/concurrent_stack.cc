@@ -0,0 +1,89 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count allocations, see `Reclamation`
+#include "abc/concurrent_stack.h"
+
+#include <atomic>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+TEST(TestConcurrentStack, Sequential) {
+  auto stack = abc::concurrent_stack<abc::data::MoveOnly>();
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.try_pop());
+  for (int i = 0; i != 10; ++i) {
+    stack.push(abc::data::MoveOnly(i));
+  }
+  stack.emplace(10);
+  EXPECT_FALSE(stack.empty());
+  for (int i = 10; i >= 0; --i) {
+    auto top = stack.try_pop();
+    ASSERT_TRUE(top);
+    EXPECT_EQ(top->Id(), i);
+  }
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.try_pop());
+}
+TEST(TestConcurrentStack, Concurrent) {
+  // Every value pushed is popped exactly once, by the pushers or afterwards:
+  constexpr int kThreads = 8, kPerThread = 20000;
+  auto stack = abc::concurrent_stack<int>();
+  auto popped = std::vector<std::atomic<int>>(kThreads * kPerThread);
+  auto threads = std::vector<std::thread>();
+  for (int t = 0; t != kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i != kPerThread; ++i) {
+        stack.push(t * kPerThread + i);
+        if (i % 2) {
+          if (auto top = stack.try_pop()) {
+            ++popped[*top];
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  while (auto top = stack.try_pop()) {
+    ++popped[*top];
+  }
+  for (auto &count : popped) {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+TEST(TestConcurrentStack, Reclamation) {
+  // Popped nodes are freed either by later pops or by the destructor:
+  using Stack = abc::concurrent_stack<int>;
+  auto scope = abc::stats_scope<Stack>();
+  {
+    auto stack = Stack();
+    auto threads = std::vector<std::thread>();
+    for (int t = 0; t != 4; ++t) {
+      threads.emplace_back([&] {
+        for (int i = 0; i != 10000; ++i) {
+          stack.push(i);
+          stack.try_pop();
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    // Only a bounded number of popped nodes are waiting to be freed:
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.allocations, 40000);
+    EXPECT_GE(delta.deallocations, 40000 - 1000);
+  }
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.deallocations, delta.allocations);
+  EXPECT_EQ(delta.destructions, delta.allocations);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count allocations, see `Segments`
+#include "abc/concurrent_vector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/data/stateful_allocator.h"
+#include "gtest/gtest.h"
+
+TEST(TestConcurrentVector, PushBack) {
+  auto v = abc::concurrent_vector<abc::data::MoveOnly>();
+  EXPECT_TRUE(v.empty());
+  auto addresses = std::vector<const abc::data::MoveOnly *>();
+  for (int i = 0; i != 1000; ++i) {
+    auto it = v.push_back(abc::data::MoveOnly(i));
+    EXPECT_EQ(it->Id(), i);
+    addresses.push_back(&*it);
+  }
+  v.emplace_back(1000);
+  EXPECT_EQ(v.size(), 1001);
+  EXPECT_GE(v.capacity(), v.size());
+  EXPECT_EQ(v.front().Id(), 0);
+  EXPECT_EQ(v.back().Id(), 1000);
+  // Growing never moves an element:
+  for (int i = 0; i != 1000; ++i) {
+    EXPECT_EQ(&v[i], addresses[i]);
+    EXPECT_EQ(v.at(i).Id(), i);
+  }
+  EXPECT_THROW(v.at(1001), std::out_of_range);
+}
+TEST(TestConcurrentVector, GrowBy) {
+  auto v = abc::concurrent_vector<std::string>();
+  auto it = v.grow_by(3, "abc");
+  EXPECT_EQ(it - v.begin(), 0);
+  it = v.grow_by({"x", "y"});
+  EXPECT_EQ(*it, "x");
+  it = v.grow_by(20);
+  EXPECT_EQ(it - v.begin(), 5);
+  EXPECT_EQ(v.size(), 25);
+  auto expected = std::vector<std::string>{"abc", "abc", "abc", "x", "y"};
+  expected.resize(25);
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(),
+                         expected.end()));
+}
+TEST(TestConcurrentVector, GrowByIntegers) {
+  // `(count, value)` of the element type is not taken for `(first, last)`:
+  auto v = abc::concurrent_vector<int>();
+  auto it = v.grow_by(3, 7);
+  EXPECT_EQ(it - v.begin(), 0);
+  v.grow_by(std::size_t(2), 8);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[2], 7);
+  EXPECT_EQ(v[4], 8);
+}
+TEST(TestConcurrentVector, Iterator) {
+  auto v = abc::concurrent_vector<int>();
+  for (int i = 0; i != 100; ++i) {
+    v.push_back(99 - i);
+  }
+  std::sort(v.begin(), v.end());
+  for (int i = 0; i != 100; ++i) {
+    EXPECT_EQ(v[i], i);
+  }
+  const auto &c = v;
+  abc::concurrent_vector<int>::const_iterator it = v.begin() + 10;
+  EXPECT_EQ(*it, 10);
+  EXPECT_EQ(it[5], 15);
+  EXPECT_EQ(c.end() - it, 90);
+  EXPECT_LT(it, c.end());
+}
+TEST(TestConcurrentVector, ThrowingConstructor) {
+  // A throw before claiming a slot leaves the size unchanged:
+  using Kitten = abc::data::Copyable;
+  auto v = abc::concurrent_vector<Kitten>();
+  v.emplace_back(1);
+  struct Bomb {
+    operator Kitten() const { throw std::runtime_error("bomb"); }  // NOLINT
+  };
+  EXPECT_THROW(v.emplace_back(Bomb()), std::runtime_error);
+  EXPECT_EQ(v.size(), 1);
+}
+TEST(TestConcurrentVector, Concurrent) {
+  // Every value appended by any thread appears exactly once:
+  constexpr int kThreads = 8, kPerThread = 10000;
+  auto v = abc::concurrent_vector<int>();
+  auto threads = std::vector<std::thread>();
+  for (int t = 0; t != kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i != kPerThread; i += 2) {
+        if (i % 4) {
+          v.push_back(t * kPerThread + i);
+          v.push_back(t * kPerThread + i + 1);
+        } else {
+          v.grow_by({t * kPerThread + i, t * kPerThread + i + 1});
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(v.size(), kThreads * kPerThread);
+  auto seen = std::vector<int>(v.begin(), v.end());
+  std::sort(seen.begin(), seen.end());
+  for (int i = 0; i != kThreads * kPerThread; ++i) {
+    ASSERT_EQ(seen[i], i);
+  }
+}
+TEST(TestConcurrentVector, Segments) {
+  // Segments double in size and are never reallocated:
+  using Vector = abc::concurrent_vector<int,
+                                        abc::data::StatefulAllocator<int>>;
+  auto scope = abc::stats_scope<Vector>();
+  {
+    auto v = Vector(abc::data::StatefulAllocator<int>());
+    v.grow_by(8 + 16 + 32 + 64);
+    EXPECT_EQ(v.capacity(), 8 + 16 + 32 + 64);
+    EXPECT_EQ(scope.delta().allocations, 4);
+    v.push_back(0);
+    EXPECT_EQ(v.capacity(), 8 + 16 + 32 + 64 + 128);
+    auto moved = Vector(std::move(v));
+    EXPECT_EQ(moved.size(), 121);
+    EXPECT_TRUE(v.empty());
+  }
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.allocations, 5);
+  EXPECT_EQ(delta.deallocations, 5);
+  EXPECT_EQ(delta.reallocations, 0);
+  EXPECT_EQ(delta.destructions, 121);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
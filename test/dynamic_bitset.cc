@@ -0,0 +1,203 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/dynamic_bitset.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+class TestDynamicBitset : public ::testing::Test {
+ protected:
+  using Bits = abc::dynamic_bitset<>;
+  // Sizes on and around the block boundaries.
+  static constexpr std::size_t kSizes[] = {0, 1, 63, 64, 65, 127, 128, 200};
+  // Random bits, as both a bitset and a `std::vector<bool>` to check it by.
+  static std::pair<Bits, std::vector<bool>> Random(std::size_t n,
+                                                   unsigned seed) {
+    auto engine = std::mt19937(seed);
+    auto bits = Bits();
+    auto expected = std::vector<bool>();
+    for (std::size_t i = 0; i != n; ++i) {
+      bool value = engine() % 3 == 0;
+      bits.push_back(value);
+      expected.push_back(value);
+    }
+    return {bits, expected};
+  }
+  static void ExpectEqual(const Bits &bits, const std::vector<bool> &expected) {
+    ASSERT_EQ(bits.size(), expected.size());
+    EXPECT_EQ(bits.count(),
+              std::count(expected.begin(), expected.end(), true));
+    for (std::size_t i = 0; i != expected.size(); ++i) {
+      ASSERT_EQ(bits[i], expected[i]) << "at " << i;
+    }
+    // The bits past `size()` are kept zero:
+    if (bits.size() % Bits::kBlockBits) {
+      auto last = bits.data()[bits.num_blocks() - 1];
+      EXPECT_EQ(last >> (bits.size() % Bits::kBlockBits), 0);
+    }
+  }
+};
+TEST_F(TestDynamicBitset, ConstructAndAccess) {
+  auto bits = Bits(100);
+  EXPECT_EQ(bits.size(), 100);
+  EXPECT_EQ(bits.num_blocks(), 2);
+  EXPECT_TRUE(bits.none());
+  bits[3] = true;
+  bits.set(70);
+  bits.flip(99);
+  EXPECT_TRUE(bits.test(3) && bits[70] && bits.back());
+  EXPECT_EQ(bits.count(), 3);
+  bits[70] = bits[4];
+  bits[3].flip();
+  EXPECT_TRUE(~bits[3]);
+  EXPECT_EQ(bits.count(), 1);
+  EXPECT_THROW(bits.at(100), std::out_of_range);
+  EXPECT_THROW(bits.set(100), std::out_of_range);
+  auto ones = Bits(70, true);
+  EXPECT_TRUE(ones.all());
+  EXPECT_EQ(ones.count(), 70);
+  EXPECT_EQ(ones.data()[1], (1u << 6) - 1);
+  ones.resize(3);
+  ones.reset(1);
+  EXPECT_EQ(ones, Bits({true, false, true}));
+  auto list = Bits{true, false, true};
+  EXPECT_EQ(list.count(), 2);
+  EXPECT_FALSE(list.all());
+  EXPECT_TRUE(Bits().all() && Bits().none());
+}
+TEST_F(TestDynamicBitset, PushPopResize) {
+  auto [bits, expected] = Random(200, 1);
+  ExpectEqual(bits, expected);
+  for (int i = 0; i != 80; ++i) {
+    bits.pop_back();
+    expected.pop_back();
+  }
+  ExpectEqual(bits, expected);
+  bits.resize(300, true);
+  expected.resize(300, true);
+  ExpectEqual(bits, expected);
+  bits.resize(65);
+  expected.resize(65);
+  ExpectEqual(bits, expected);
+  bits.resize(130);
+  expected.resize(130);
+  ExpectEqual(bits, expected);
+  bits.reserve(1000);
+  EXPECT_GE(bits.capacity(), 1000);
+  bits.shrink_to_fit();
+  EXPECT_EQ(bits.capacity(), 192);
+  auto moved = std::move(bits);
+  EXPECT_TRUE(bits.empty());
+  ExpectEqual(moved, expected);
+  bits = moved;
+  EXPECT_EQ(bits, moved);
+  moved.clear();
+  EXPECT_NE(bits, moved);
+}
+TEST_F(TestDynamicBitset, Iterators) {
+  auto [bits, expected] = Random(150, 2);
+  EXPECT_EQ(bits.end() - bits.begin(), 150);
+  EXPECT_TRUE(std::equal(bits.begin(), bits.end(), expected.begin()));
+  for (auto bit : bits) {
+    bit.flip();
+  }
+  expected.flip();
+  ExpectEqual(bits, expected);
+  const auto &c = bits;
+  auto iter = std::find(c.begin(), c.end(), true);
+  EXPECT_EQ(iter - c.begin(),
+            std::find(expected.begin(), expected.end(), true) -
+            expected.begin());
+  Bits::const_iterator first = bits.begin();
+  EXPECT_TRUE(first <= iter && iter < c.end());
+  EXPECT_EQ(*(bits.end() - 1), expected.back());
+  EXPECT_EQ(first[149], expected.back());
+}
+TEST_F(TestDynamicBitset, RangeOperations) {
+  for (auto n : kSizes) {
+    for (std::size_t pos = 0; pos <= n; pos += 7) {
+      auto rest = n - pos;
+      for (auto count : {std::size_t(0), std::min<std::size_t>(1, rest),
+                         rest}) {
+        auto [bits, expected] = Random(n, 3);
+        bits.set(pos, count, true);
+        std::fill_n(expected.begin() + pos, count, true);
+        ExpectEqual(bits, expected);
+        bits.flip(pos / 2, n - pos / 2);
+        for (auto i = pos / 2; i != n; ++i) {
+          expected[i] = !expected[i];
+        }
+        ExpectEqual(bits, expected);
+        bits.reset(pos, count);
+        std::fill_n(expected.begin() + pos, count, false);
+        ExpectEqual(bits, expected);
+      }
+    }
+    auto bits = Bits(n);
+    EXPECT_THROW(bits.set(0, n + 1, true), std::out_of_range);
+    EXPECT_THROW(bits.reset(n + 1, 0), std::out_of_range);
+    EXPECT_EQ(bits.set().count(), n);
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(bits.flip().count(), 0);
+  }
+}
+TEST_F(TestDynamicBitset, BitwiseOperators) {
+  for (auto n : kSizes) {
+    auto [a, x] = Random(n, 4);
+    auto [b, y] = Random(n, 5);
+    auto expected = std::vector<bool>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      expected[i] = x[i] && y[i];
+    }
+    ExpectEqual(a & b, expected);
+    for (std::size_t i = 0; i != n; ++i) {
+      expected[i] = x[i] || y[i];
+    }
+    ExpectEqual(a | b, expected);
+    for (std::size_t i = 0; i != n; ++i) {
+      expected[i] = x[i] != y[i];
+    }
+    ExpectEqual(a ^ b, expected);
+    x.flip();
+    ExpectEqual(~a, x);
+    EXPECT_EQ(a ^ a, Bits(n));
+    EXPECT_EQ(~(a & b), ~a | ~b);
+  }
+  auto a = Bits(10), b = Bits(11);
+  EXPECT_THROW(a &= b, std::invalid_argument);
+}
+TEST_F(TestDynamicBitset, FindSetBits) {
+  for (auto n : kSizes) {
+    auto [bits, expected] = Random(n, 6);
+    auto positions = std::vector<std::size_t>();
+    for (auto i = bits.find_first(); i != Bits::npos; i = bits.find_next(i)) {
+      positions.push_back(i);
+    }
+    auto expected_positions = std::vector<std::size_t>();
+    for (std::size_t i = 0; i != n; ++i) {
+      if (expected[i]) {
+        expected_positions.push_back(i);
+      }
+    }
+    EXPECT_EQ(positions, expected_positions);
+    EXPECT_EQ(bits.find_next(n), Bits::npos);
+  }
+  // Long runs of zero blocks are skipped:
+  auto sparse = Bits(1 << 20);
+  sparse.set(5).set(64 * 1000 + 63).set((1 << 20) - 1);
+  EXPECT_EQ(sparse.find_first(), 5);
+  EXPECT_EQ(sparse.find_next(5), 64 * 1000 + 63);
+  EXPECT_EQ(sparse.find_next(64 * 1000 + 63), (1 << 20) - 1);
+  EXPECT_EQ(sparse.find_next((1 << 20) - 1), Bits::npos);
+  EXPECT_EQ(Bits(100).find_first(), Bits::npos);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
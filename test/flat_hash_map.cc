@@ -0,0 +1,260 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count allocations, see `GrowAndReserve`
+#include "abc/flat_hash_map.h"
+#include "abc/flat_hash_set.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/data/stateful_allocator.h"
+#include "gtest/gtest.h"
+
+class TestFlatHashMap : public ::testing::Test {
+ protected:
+  using Kitten = abc::data::Copyable;
+  using Map = abc::flat_hash_map<int, Kitten>;
+  template <class M>
+  static std::vector<int> SortedKeys(const M &map) {
+    auto keys = std::vector<int>();
+    for (auto &[key, value] : map) {
+      keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  }
+};
+TEST_F(TestFlatHashMap, InsertAndFind) {
+  auto map = Map();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(0), map.end());
+  for (int i = 0; i != 100; ++i) {
+    auto [iter, inserted] = map.emplace(i, Kitten(i * 10));
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(iter->first, i);
+    EXPECT_EQ(iter->second.Id(), i * 10);
+  }
+  EXPECT_EQ(map.size(), 100);
+  auto [iter, inserted] = map.insert({7, Kitten(-7)});
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(iter->second.Id(), 70);
+  for (int i = 0; i != 100; ++i) {
+    ASSERT_TRUE(map.contains(i));
+    EXPECT_EQ(map.find(i)->second.Id(), i * 10);
+  }
+  EXPECT_FALSE(map.contains(100));
+  EXPECT_EQ(map.count(-1), 0);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 100);
+}
+TEST_F(TestFlatHashMap, MapOperations) {
+  auto map = Map();
+  map[1] = Kitten(10);
+  EXPECT_EQ(map[1].Id(), 10);
+  EXPECT_EQ(map[2].Id(), -1);
+  EXPECT_EQ(map.at(1).Id(), 10);
+  EXPECT_THROW(map.at(3), std::out_of_range);
+  EXPECT_FALSE(map.try_emplace(1, 11).second);
+  EXPECT_EQ(map.at(1).Id(), 10);
+  EXPECT_TRUE(map.try_emplace(3, 30).second);
+  EXPECT_FALSE(map.insert_or_assign(3, Kitten(31)).second);
+  EXPECT_EQ(map.at(3).Id(), 31);
+  EXPECT_EQ(SortedKeys(map), std::vector<int>({1, 2, 3}));
+  // Keys are moved in, but only if absent:
+  auto strings = abc::flat_hash_map<std::string, int>();
+  auto key = std::string("a long key that is not stored inline");
+  strings.try_emplace(std::move(key), 1);
+  EXPECT_TRUE(key.empty());  // NOLINT
+  key = "a long key that is not stored inline";
+  strings.try_emplace(std::move(key), 2);
+  EXPECT_FALSE(key.empty());  // NOLINT
+  EXPECT_EQ(strings.at(key), 1);
+}
+TEST_F(TestFlatHashMap, Erase) {
+  auto map = Map();
+  for (int i = 0; i != 100; ++i) {
+    map.emplace(i, Kitten(i));
+  }
+  EXPECT_EQ(map.erase(100), 0);
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(map.erase(i), 1);
+  }
+  EXPECT_EQ(map.size(), 50);
+  for (int i = 0; i != 100; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1);
+  }
+  auto iter = map.find(51);
+  iter = map.erase(iter);
+  EXPECT_FALSE(map.contains(51));
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 49);
+  EXPECT_EQ(abc::erase_if(map, [](auto &pair) { return pair.first > 50; }),
+            24);
+  EXPECT_EQ(SortedKeys(map), std::vector<int>({1, 3, 5, 7, 9, 11, 13, 15,
+      17, 19, 21, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41, 43, 45, 47, 49}));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+TEST_F(TestFlatHashMap, GrowAndReserve) {
+  using Stats = abc::stats_scope<Map>;
+  auto map = Map();
+  {
+    auto scope = Stats();
+    for (int i = 0; i != 1000; ++i) {
+      map.try_emplace(i, i);
+    }
+    // Capacities 16, 32, ..., 2048 are allocated one after another:
+    EXPECT_EQ(scope.delta().allocations, 8);
+    EXPECT_EQ(scope.delta().deallocations, 7);
+    EXPECT_EQ(scope.delta().reallocations, 8);
+  }
+  auto other = Map();
+  other.reserve(1000);
+  {
+    auto scope = Stats();
+    for (int i = 0; i != 1000; ++i) {
+      other.try_emplace(i, i);
+    }
+    EXPECT_EQ(scope.delta().allocations, 0);
+    EXPECT_EQ(scope.delta().reallocations, 0);
+  }
+  EXPECT_EQ(map, other);
+  map.erase(0);
+  EXPECT_NE(map, other);
+  map.rehash(0);
+  EXPECT_EQ(map.capacity(), 2048);
+  map.clear();
+  map.rehash(0);
+  EXPECT_EQ(map.capacity(), 0);
+  // Too many slots to count their bytes:
+  EXPECT_THROW(map.reserve(SIZE_MAX), std::length_error);
+  EXPECT_THROW(map.rehash(SIZE_MAX), std::length_error);
+  EXPECT_THROW(map.reserve(Map::max_size() + 1), std::length_error);
+  EXPECT_EQ(map.capacity(), 0);
+}
+TEST_F(TestFlatHashMap, CopyAndMove) {
+  using Allocator = abc::data::StatefulAllocator<std::pair<const int, Kitten>>;
+  using AllocMap = abc::flat_hash_map<int, Kitten, std::hash<int>,
+                                      std::equal_to<int>, Allocator>;
+  auto alloc = Allocator();
+  {
+    auto map = AllocMap(alloc);
+    for (int i = 0; i != 100; ++i) {
+      map.try_emplace(i, i);
+    }
+    auto copy = map;
+    EXPECT_EQ(copy, map);
+    auto moved = std::move(map);
+    EXPECT_TRUE(map.empty());  // NOLINT
+    EXPECT_EQ(moved, copy);
+    map = moved;
+    EXPECT_EQ(map, copy);
+    copy = AllocMap();  // the new allocator propagates
+    EXPECT_TRUE(copy.empty());
+    moved = std::move(map);
+    EXPECT_EQ(moved.size(), 100);
+    moved.swap(map);
+    EXPECT_EQ(map.size(), 100);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_GT(alloc.Bytes(), 0);
+  }
+  EXPECT_EQ(alloc.Bytes(), 0);
+  // Move-only values are moved when the table grows:
+  auto map = abc::flat_hash_map<int, abc::data::MoveOnly>();
+  for (int i = 0; i != 100; ++i) {
+    map.try_emplace(i, i);
+  }
+  for (int i = 0; i != 100; ++i) {
+    EXPECT_EQ(map.at(i).Id(), i);
+  }
+}
+TEST_F(TestFlatHashMap, EmplaceFromOwnElement) {
+  // The table grows after constructing the new element, which is copied
+  // from an old one:
+  auto map = Map();
+  map.try_emplace(0, 0);
+  for (int i = 1; i != 1000; ++i) {
+    map.try_emplace(i, map.at(i - 1));
+  }
+  for (int i = 0; i != 1000; ++i) {
+    EXPECT_EQ(map.at(i).Id(), 0);
+  }
+}
+TEST_F(TestFlatHashMap, RandomChurn) {
+  // Clusters of equal hashes are shifted back on erase, so random inserts
+  // and erases always agree with std::unordered_map:
+  struct Clustered {
+    std::size_t operator()(int key) const { return key / 8; }
+  };
+  auto map = abc::flat_hash_map<int, int, Clustered>();
+  auto expected = std::unordered_map<int, int>();
+  auto random = std::mt19937(42);
+  for (int step = 0; step != 50000; ++step) {
+    int key = random() % 2000;
+    if (random() % 2) {
+      ASSERT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      ASSERT_EQ(map.try_emplace(key, step).second,
+                expected.try_emplace(key, step).second);
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  for (int key = 0; key != 2000; ++key) {
+    auto iter = expected.find(key);
+    if (iter == expected.end()) {
+      EXPECT_FALSE(map.contains(key));
+    } else {
+      EXPECT_EQ(map.at(key), iter->second);
+    }
+  }
+  EXPECT_EQ(std::distance(map.begin(), map.end()), expected.size());
+}
+
+// A hash accepting any string-like type, for heterogeneous lookup:
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+TEST(TestFlatHashSet, InsertFindErase) {
+  auto set = abc::flat_hash_set<int>({3, 1, 4, 1, 5, 9, 2, 6});
+  EXPECT_EQ(set.size(), 7);
+  EXPECT_TRUE(set.contains(9));
+  EXPECT_FALSE(set.contains(7));
+  EXPECT_FALSE(set.insert(4).second);
+  EXPECT_TRUE(set.insert(7).second);
+  EXPECT_EQ(set.erase(1), 1);
+  EXPECT_EQ(set.erase(1), 0);
+  auto keys = std::vector<int>(set.begin(), set.end());
+  std::sort(keys.begin(), keys.end());
+  EXPECT_EQ(keys, std::vector<int>({2, 3, 4, 5, 6, 7, 9}));
+  EXPECT_EQ(set, abc::flat_hash_set<int>({9, 7, 6, 5, 4, 3, 2}));
+}
+TEST(TestFlatHashSet, HeterogeneousLookup) {
+  auto set = abc::flat_hash_set<std::string, StringHash, std::equal_to<>>();
+  set.insert("apple");
+  set.emplace(3, 'x');
+  EXPECT_TRUE(set.contains("apple"));
+  EXPECT_TRUE(set.contains(std::string_view("xxx")));
+  EXPECT_EQ(set.find("pear"), set.end());
+  EXPECT_EQ(*set.find(std::string_view("apple")), "apple");
+  EXPECT_EQ(set.erase(std::string_view("xxx")), 1);
+  EXPECT_EQ(set.erase(set.find("apple")), set.end());
+  EXPECT_TRUE(set.empty());
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,223 @@
+// Copyright 2026 Weicheng Pei
+
+#include "abc/flat_map.h"
+#include "abc/flat_set.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+class TestFlatSet : public ::testing::Test {
+ protected:
+  using Set = abc::flat_set<int>;
+  static std::vector<int> Keys(const Set &set) {
+    return std::vector<int>(set.begin(), set.end());
+  }
+};
+TEST_F(TestFlatSet, Construct) {
+  auto set = Set{5, 3, 1, 3, 4, 1};
+  EXPECT_EQ(Keys(set), (std::vector<int>{1, 3, 4, 5}));
+  auto sorted = Set(abc::sorted_unique, {1, 2, 4});
+  EXPECT_EQ(Keys(sorted), (std::vector<int>{1, 2, 4}));
+  auto from_keys = Set(abc::vector<int>{2, 2, 0});
+  EXPECT_EQ(Keys(from_keys), (std::vector<int>{0, 2}));
+  auto reversed = abc::flat_set<int, std::greater<int>>{1, 3, 2};
+  EXPECT_EQ(*reversed.begin(), 3);
+  set = {7, 6, 7};
+  EXPECT_EQ(Keys(set), (std::vector<int>{6, 7}));
+}
+TEST_F(TestFlatSet, InsertFindErase) {
+  auto set = Set();
+  for (int i : {4, 2, 8, 6, 2}) {
+    set.insert(i);
+  }
+  EXPECT_EQ(Keys(set), (std::vector<int>{2, 4, 6, 8}));
+  EXPECT_FALSE(set.insert(4).second);
+  EXPECT_EQ(*set.emplace(5).first, 5);
+  EXPECT_TRUE(set.contains(5));
+  EXPECT_FALSE(set.contains(3));
+  EXPECT_EQ(set.find(3), set.end());
+  EXPECT_EQ(*set.lower_bound(3), 4);
+  EXPECT_EQ(*set.upper_bound(4), 5);
+  auto [first, last] = set.equal_range(6);
+  EXPECT_EQ(last - first, 1);
+  EXPECT_EQ(set.erase(5), 1);
+  EXPECT_EQ(set.erase(5), 0);
+  set.erase(set.begin());
+  EXPECT_EQ(Keys(set), (std::vector<int>{4, 6, 8}));
+  EXPECT_EQ(set.erase_if([](int key) { return key > 5; }), 2);
+  EXPECT_EQ(Keys(set), (std::vector<int>{4}));
+}
+TEST_F(TestFlatSet, BulkInsert) {
+  auto expected = std::set<int>();
+  auto set = Set();
+  auto engine = std::mt19937(2026);
+  auto dist = std::uniform_int_distribution<int>(0, 999);
+  for (int round = 0; round != 20; ++round) {
+    auto batch = std::vector<int>(100);
+    for (auto &key : batch) {
+      key = dist(engine);
+    }
+    expected.insert(batch.begin(), batch.end());
+    set.insert(batch.begin(), batch.end());
+    ASSERT_EQ(Keys(set), std::vector<int>(expected.begin(), expected.end()));
+  }
+  // Keys after all the old ones are appended:
+  auto size = set.size();
+  set.reserve(size + 10);
+  auto data = set.keys().data();
+  auto tail = std::vector<int>{1003, 1001, 1002, 1001};
+  set.insert(tail.begin(), tail.end());
+  EXPECT_EQ(set.size(), size + 3);
+  EXPECT_EQ(set.keys().data(), data);
+  set.insert(abc::sorted_unique, tail.begin(), tail.begin() + 1);
+  EXPECT_EQ(set.size(), size + 3);
+}
+TEST_F(TestFlatSet, Transparent) {
+  auto set = abc::flat_set<std::string, std::less<>>{"b", "a", "c"};
+  EXPECT_TRUE(set.contains(std::string_view("a")));
+  EXPECT_EQ(*set.find(std::string_view("c")), "c");
+  EXPECT_EQ(set.count("d"), 0);
+}
+TEST_F(TestFlatSet, ExtractAndReplace) {
+  auto set = Set{3, 1, 2};
+  auto keys = std::move(set).extract();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(keys, (abc::vector<int>{1, 2, 3}));
+  keys.push_back(4);
+  set.replace(std::move(keys));
+  EXPECT_EQ(Keys(set), (std::vector<int>{1, 2, 3, 4}));
+  auto other = Set{0};
+  swap(set, other);
+  EXPECT_EQ(set, Set{0});
+  EXPECT_NE(set, other);
+}
+
+class TestFlatMap : public ::testing::Test {
+ protected:
+  using Kitten = abc::data::Copyable;
+  using Map = abc::flat_map<int, Kitten>;
+};
+TEST_F(TestFlatMap, InsertAndFind) {
+  auto map = Map();
+  EXPECT_EQ(map.find(0), map.end());
+  for (int i : {5, 1, 9, 3, 7}) {
+    auto [iter, inserted] = map.emplace(i, Kitten(i * 10));
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(iter->first, i);
+    EXPECT_EQ(iter->second.Id(), i * 10);
+  }
+  auto [iter, inserted] = map.insert({3, Kitten(-3)});
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(iter->second.Id(), 30);
+  EXPECT_EQ(map.keys(), (abc::vector<int>{1, 3, 5, 7, 9}));
+  EXPECT_EQ(map.values()[2].Id(), 50);
+  EXPECT_TRUE(map.contains(7));
+  EXPECT_FALSE(map.contains(4));
+  EXPECT_EQ(map.lower_bound(4)->first, 5);
+  EXPECT_EQ(map.upper_bound(5)->first, 7);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 5);
+  int sum = 0;
+  for (auto [key, value] : map) {
+    sum += key;
+    EXPECT_EQ(value.Id(), key * 10);
+  }
+  EXPECT_EQ(sum, 25);
+  // An iterator writes the mapped value in place:
+  map.begin()->second = Kitten(-1);
+  (*map.find(9)).second = Kitten(-9);
+  EXPECT_EQ(map.at(1).Id(), -1);
+  EXPECT_EQ(map.at(9).Id(), -9);
+  EXPECT_THROW(map.at(2), std::out_of_range);
+}
+TEST_F(TestFlatMap, MapOperations) {
+  auto map = Map();
+  EXPECT_EQ(map[4].Id(), -1);
+  map[4] = Kitten(4);
+  EXPECT_EQ(map[4].Id(), 4);
+  EXPECT_FALSE(map.try_emplace(4, 40).second);
+  EXPECT_TRUE(map.try_emplace(2, 20).second);
+  EXPECT_FALSE(map.insert_or_assign(2, Kitten(22)).second);
+  EXPECT_EQ(map.at(2).Id(), 22);
+  EXPECT_TRUE(map.insert_or_assign(3, Kitten(33)).second);
+  EXPECT_EQ(map.keys(), (abc::vector<int>{2, 3, 4}));
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  map.erase(map.begin());
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.begin()->first, 4);
+  // Move-only values are moved between the containers:
+  auto owners = abc::flat_map<int, abc::data::MoveOnly>();
+  for (int i = 10; i != 0; --i) {
+    owners.try_emplace(i, i);
+  }
+  owners.erase_if([](auto pair) { return pair.first % 2; });
+  EXPECT_EQ(owners.size(), 5);
+  for (auto [key, value] : owners) {
+    EXPECT_EQ(value.Id(), key);
+  }
+}
+TEST_F(TestFlatMap, Construct) {
+  auto map = abc::flat_map<int, int>{{3, 30}, {1, 10}, {3, 31}, {2, 20}};
+  EXPECT_EQ(map.keys(), (abc::vector<int>{1, 2, 3}));
+  // The first of equivalent keys is kept:
+  EXPECT_EQ(map.values(), (abc::vector<int>{10, 20, 30}));
+  auto zipped = abc::flat_map<int, int>(abc::vector<int>{2, 0, 2, 1},
+                                        abc::vector<int>{20, 0, 21, 10});
+  EXPECT_EQ(zipped.keys(), (abc::vector<int>{0, 1, 2}));
+  EXPECT_EQ(zipped.values(), (abc::vector<int>{0, 10, 20}));
+  auto sorted = abc::flat_map<int, int>(abc::sorted_unique,
+      abc::vector<int>{0, 1, 2}, abc::vector<int>{0, 10, 20});
+  EXPECT_EQ(sorted, zipped);
+  auto [keys, values] = std::move(sorted).extract();
+  EXPECT_TRUE(sorted.empty());
+  keys.push_back(3);
+  values.push_back(30);
+  sorted.replace(std::move(keys), std::move(values));
+  EXPECT_EQ(sorted.at(3), 30);
+  EXPECT_NE(sorted, zipped);
+}
+TEST_F(TestFlatMap, BulkInsert) {
+  auto expected = std::map<int, int>();
+  auto map = abc::flat_map<int, int>();
+  auto engine = std::mt19937(2026);
+  auto dist = std::uniform_int_distribution<int>(0, 999);
+  for (int round = 0; round != 20; ++round) {
+    auto batch = std::vector<std::pair<int, int>>(100);
+    for (auto &[key, value] : batch) {
+      key = dist(engine);
+      value = round;
+    }
+    expected.insert(batch.begin(), batch.end());
+    map.insert(batch.begin(), batch.end());
+    ASSERT_EQ(map.size(), expected.size());
+    ASSERT_TRUE(std::equal(map.begin(), map.end(), expected.begin(),
+        [](auto a, auto b) { return a.first == b.first && a.second == b.second; }));
+  }
+  // A sorted map of the same elements, from `std::map`:
+  auto copied = abc::flat_map<int, int>(abc::sorted_unique,
+                                        expected.begin(), expected.end());
+  EXPECT_EQ(copied, map);
+}
+TEST_F(TestFlatMap, Transparent) {
+  auto map = abc::flat_map<std::string, int, std::less<>>{{"b", 2}, {"a", 1}};
+  EXPECT_TRUE(map.contains(std::string_view("a")));
+  EXPECT_EQ(map.find(std::string_view("b"))->second, 2);
+  EXPECT_EQ(map.lower_bound(std::string_view("aa"))->first, "b");
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
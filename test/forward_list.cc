@@ -1,14 +1,18 @@
 // Copyright 2019 Weicheng Pei
 
-// #define ABC_USE_SMART_POINTER_
-
+#define ABC_ENABLE_STATS  // count allocations, see `Performance`
 #include "abc/forward_list.h"
 
 #include <algorithm>
-#include <chrono>  // NOLINT
 #include <forward_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "abc/data/copyable.h"
+#include "abc/data/stateful_allocator.h"
+#include "abc/memory_resource.h"
 #include "gtest/gtest.h"
 
 class TestForwardList : public ::testing::Test {
@@ -19,6 +23,11 @@ class TestForwardList : public ::testing::Test {
   std::forward_list<int> std_list_of_id{ 4, 3, 2, 1 };
   std::forward_list<Kitten> std_list_of_kitten;
   abc::forward_list<Kitten> abc_list_of_kitten;
+  // build a list from ids
+  template <class List = abc::forward_list<Kitten>>
+  static List MakeList(std::initializer_list<int> ids) {
+    return List(ids.begin(), ids.end());
+  }
 };
 TEST_F(TestForwardList, Empty) {
   EXPECT_EQ(abc_list_of_kitten.empty(), std_list_of_kitten.empty());
@@ -122,6 +131,16 @@ TEST_F(TestForwardList, Equal) {
   EXPECT_FALSE(abc_list_of_kitten != abc_list_of_kitten);
   EXPECT_FALSE(new_list_of_kitten != abc_list_of_kitten);
 }
+TEST_F(TestForwardList, Compare) {
+  auto lhs = abc::forward_list<int>{1, 2, 3};
+  auto rhs = abc::forward_list<int>{1, 2, 4};
+  EXPECT_TRUE(lhs < rhs && lhs <= rhs);
+  EXPECT_TRUE(rhs > lhs && rhs >= lhs);
+  EXPECT_FALSE(lhs > rhs || lhs >= rhs);
+  EXPECT_TRUE(lhs <= lhs && lhs >= lhs);
+  rhs = {1, 2};  // a prefix is less
+  EXPECT_TRUE(lhs > rhs);
+}
 TEST_F(TestForwardList, Copy) {
   for (const auto& i : std_list_of_id) {
     abc_list_of_kitten.emplace_front(i);
@@ -151,20 +170,269 @@ TEST_F(TestForwardList, Move) {
   moved_list_of_kitten = abc::move(moved_list_of_kitten);
   EXPECT_EQ(moved_list_of_kitten, abc_list_of_kitten);
 }
-TEST_F(TestForwardList, Performance) {
-  using clock = std::chrono::high_resolution_clock;
-  auto ticks = [](auto& list) {
-    auto start = clock::now();
-    for (int i = 0; i != 1000000; ++i) {
-      list.emplace_front(i);
+TEST_F(TestForwardList, StatefulAllocator) {
+  using Allocator = abc::data::StatefulAllocator<Kitten>;
+  // A stateless allocator takes no space:
+  static_assert(sizeof(abc::forward_list<Kitten>) == sizeof(void *));
+  auto alloc_a = Allocator(), alloc_b = Allocator();
+  {
+    auto a = abc::forward_list<Kitten, Allocator>(alloc_a);
+    auto b = abc::forward_list<Kitten, Allocator>(alloc_b);
+    for (const auto& i : std_list_of_id) {
+      a.emplace_front(i);
     }
-    list.clear();
-    std::chrono::duration<double> duration = clock::now() - start;
-    return duration.count();
-  };
-  auto t_std = ticks(std_list_of_kitten);
-  auto t_abc = ticks(abc_list_of_kitten);
-  EXPECT_LT(t_abc, t_std);
+    // The allocator is rebound to nodes, but shares the counter:
+    EXPECT_EQ(a.get_allocator(), alloc_a);
+    EXPECT_GT(alloc_a.Bytes(), 4 * sizeof(Kitten));
+    EXPECT_EQ(alloc_b.Bytes(), 0);
+    // Copy assignment propagates the allocator:
+    b = a;
+    EXPECT_EQ(b.get_allocator(), alloc_a);
+    EXPECT_EQ(b, a);
+    // Move assignment propagates the allocator:
+    auto c = abc::forward_list<Kitten, Allocator>(alloc_b);
+    c.emplace_front(0);
+    c = abc::move(b);
+    EXPECT_EQ(c.get_allocator(), alloc_a);
+    EXPECT_EQ(alloc_b.Bytes(), 0);
+    EXPECT_EQ(c, a);
+    // Swap propagates the allocators:
+    auto d = abc::forward_list<Kitten, Allocator>(alloc_b);
+    d.emplace_front(0);
+    c.swap(d);
+    EXPECT_EQ(c.get_allocator(), alloc_b);
+    EXPECT_EQ(d.get_allocator(), alloc_a);
+    EXPECT_EQ(d, a);
+    c.pop_front();
+    EXPECT_EQ(alloc_b.Bytes(), 0);
+  }
+  EXPECT_EQ(alloc_a.Bytes(), 0);
+}
+TEST_F(TestForwardList, PolymorphicAllocator) {
+  using List = abc::forward_list<Kitten, abc::polymorphic_allocator<Kitten>>;
+  alignas(std::max_align_t) char buffer[1024];
+  auto arena = abc::monotonic_buffer_resource(
+      buffer, sizeof(buffer), abc::null_memory_resource());
+  auto list = List(&arena);
+  for (const auto& i : std_list_of_id) {
+    list.emplace_front(i);
+    std_list_of_kitten.emplace_front(i);
+  }
+  EXPECT_EQ(list.get_allocator().resource(), &arena);
+  auto iter = std_list_of_kitten.begin();
+  for (auto& x : list) {
+    EXPECT_EQ(x, *iter++);
+  }
+  // Move assignment between different resources moves node by node:
+  auto moved = List();
+  moved = abc::move(list);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(moved.get_allocator().resource(), abc::get_default_resource());
+  EXPECT_EQ(moved.front(), std_list_of_kitten.front());
+}
+TEST_F(TestForwardList, PoolAllocator) {
+  using List = abc::forward_list<Kitten, abc::pool_allocator<Kitten>>;
+  auto list = List();
+  for (const auto& i : std_list_of_id) {
+    list.emplace_front(i);
+  }
+  // Popped nodes are recycled:
+  auto *address = &list.front();
+  list.pop_front();
+  list.emplace_front(0);
+  EXPECT_EQ(&list.front(), address);
+  // Copies share the pool:
+  auto copied = list;
+  EXPECT_EQ(copied.get_allocator(), list.get_allocator());
+  EXPECT_EQ(copied, list);
+  auto moved = abc::move(copied);
+  EXPECT_EQ(moved, list);
+}
+TEST_F(TestForwardList, Constructors) {
+  auto from_range = abc::forward_list<Kitten>(
+      std_list_of_id.begin(), std_list_of_id.end());
+  auto from_init = abc::forward_list<Kitten>(
+      {Kitten(4), Kitten(3), Kitten(2), Kitten(1)});
+  EXPECT_EQ(from_range, from_init);
+  auto iter = std_list_of_id.begin();
+  for (auto& x : from_init) {
+    EXPECT_EQ(x, Kitten(*iter++));
+  }
+  EXPECT_TRUE(abc::forward_list<Kitten>({}).empty());
+}
+TEST_F(TestForwardList, InsertAfter) {
+  auto std_iter = std_list_of_kitten.before_begin();
+  auto abc_iter = abc_list_of_kitten.before_begin();
+  std_iter = std_list_of_kitten.insert_after(
+      std_iter, std_list_of_id.begin(), std_list_of_id.end());
+  abc_iter = abc_list_of_kitten.insert_after(
+      abc_iter, std_list_of_id.begin(), std_list_of_id.end());
+  EXPECT_EQ(*abc_iter, *std_iter);
+  std_iter = std_list_of_kitten.insert_after(std_iter, 3, Kitten(7));
+  abc_iter = abc_list_of_kitten.insert_after(abc_iter, 3, Kitten(7));
+  EXPECT_EQ(*abc_iter, *std_iter);
+  std_iter = std_list_of_kitten.insert_after(
+      std_list_of_kitten.begin(), {Kitten(5), Kitten(6)});
+  abc_iter = abc_list_of_kitten.insert_after(
+      abc_list_of_kitten.begin(), {Kitten(5), Kitten(6)});
+  EXPECT_EQ(*abc_iter, *std_iter);
+  // An empty range returns the given position:
+  abc_iter = abc_list_of_kitten.begin();
+  EXPECT_EQ(abc_list_of_kitten.insert_after(abc_iter, 0, Kitten(0)),
+            abc_iter);
+  EXPECT_TRUE(std::equal(abc_list_of_kitten.begin(), abc_list_of_kitten.end(),
+                         std_list_of_kitten.begin(), std_list_of_kitten.end()));
+}
+TEST_F(TestForwardList, EraseAfter) {
+  auto abc_list = MakeList({0, 1, 2, 3, 4, 5});
+  auto std_list = MakeList<std::forward_list<Kitten>>({0, 1, 2, 3, 4, 5});
+  auto abc_iter = abc_list.erase_after(abc_list.begin());
+  auto std_iter = std_list.erase_after(std_list.begin());
+  EXPECT_EQ(*abc_iter, *std_iter);
+  abc_iter = abc_list.erase_after(abc_list.begin(),
+                                  std::next(abc_list.begin(), 3));
+  std_iter = std_list.erase_after(std_list.begin(),
+                                  std::next(std_list.begin(), 3));
+  EXPECT_EQ(*abc_iter, *std_iter);
+  abc_iter = abc_list.erase_after(abc_list.before_begin(), abc_list.end());
+  EXPECT_EQ(abc_iter, abc_list.end());
+  EXPECT_TRUE(abc_list.empty());
+}
+TEST_F(TestForwardList, SpliceAfter) {
+  using List = decltype(abc_list_of_kitten);
+  auto a = MakeList({0, 1, 2}), b = MakeList({3, 4, 5, 6});
+  const auto expected = std::vector<List>{
+      MakeList({4, 0, 1, 2}), MakeList({3, 5, 6}),
+      MakeList({4, 3, 5, 0, 1, 2}), MakeList({6}),
+      MakeList({4, 3, 5, 0, 1, 2, 6})};
+  auto scope = abc::stats_scope<List>();
+  // a single element:
+  a.splice_after(a.before_begin(), b, b.begin());
+  EXPECT_EQ(a, expected[0]);
+  EXPECT_EQ(b, expected[1]);
+  // a range (first, last):
+  a.splice_after(a.begin(), b, b.before_begin(), std::next(b.begin(), 2));
+  EXPECT_EQ(a, expected[2]);
+  EXPECT_EQ(b, expected[3]);
+  // a whole list:
+  a.splice_after(std::next(a.begin(), 5), abc::move(b));
+  EXPECT_EQ(a, expected[4]);
+  EXPECT_TRUE(b.empty());
+  // splicing from an empty list does nothing:
+  a.splice_after(a.before_begin(), b);
+  EXPECT_EQ(a, expected[4]);
+  // Nodes are relinked, not copied:
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.allocations, 0);
+  EXPECT_EQ(delta.copies + delta.moves, 0);
+}
+TEST_F(TestForwardList, Sort) {
+  using List = decltype(abc_list_of_kitten);
+  for (int n : {0, 1, 2, 3, 7, 64, 1000}) {
+    auto ids = std::vector<int>(n);
+    for (int i = 0; i != n; ++i) {
+      ids[i] = (i * 7919) % 13;
+    }
+    auto abc_list = List(ids.begin(), ids.end());
+    auto std_list = std::forward_list<Kitten>(ids.begin(), ids.end());
+    auto scope = abc::stats_scope<List>();
+    abc_list.sort();
+    std_list.sort();
+    EXPECT_TRUE(std::equal(abc_list.begin(), abc_list.end(),
+                           std_list.begin(), std_list.end()));
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.allocations, 0);
+    EXPECT_EQ(delta.copies + delta.moves, 0);
+  }
+  // The sort is stable:
+  auto pairs = abc::forward_list<std::pair<int, int>>();
+  for (int i = 0; i != 100; ++i) {
+    pairs.emplace_front(i % 3, i);
+  }
+  pairs.sort([](auto &x, auto &y) { return x.first < y.first; });
+  EXPECT_TRUE(std::is_sorted(pairs.begin(), pairs.end(),
+      [](auto &x, auto &y) {
+        return x.first < y.first || (x.first == y.first && x.second > y.second);
+      }));
+  // A throwing comparison keeps every element:
+  auto list = MakeList({5, 4, 3, 2, 1, 0});
+  int calls = 0;
+  EXPECT_THROW(list.sort([&calls](const Kitten &x, const Kitten &y) {
+    if (++calls == 4) {
+      throw std::runtime_error("comp");
+    }
+    return x < y;
+  }), std::runtime_error);
+  auto ids = std::vector<int>();
+  for (auto &x : list) {
+    ids.push_back(x.Id());
+  }
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(ids, std::vector<int>({0, 1, 2, 3, 4, 5}));
+}
+TEST_F(TestForwardList, Merge) {
+  auto a = MakeList({1, 3, 5, 7}), b = MakeList({0, 3, 4, 8, 9});
+  auto *a3 = &*std::next(a.begin()), *b3 = &*std::next(b.begin());
+  a.merge(b);
+  EXPECT_EQ(a, MakeList({0, 1, 3, 3, 4, 5, 7, 8, 9}));
+  EXPECT_TRUE(b.empty());
+  // The equal element of this comes first, and nodes are not copied:
+  EXPECT_EQ(&*std::next(a.begin(), 2), a3);
+  EXPECT_EQ(&*std::next(a.begin(), 3), b3);
+  a.merge(MakeList({10, 2}), [](auto &x, auto &y) { return x.Id() % 10 <
+                                                         y.Id() % 10; });
+  EXPECT_EQ(a, MakeList({0, 10, 1, 2, 3, 3, 4, 5, 7, 8, 9}));
+}
+TEST_F(TestForwardList, Reverse) {
+  auto list = MakeList({});
+  list.reverse();
+  EXPECT_TRUE(list.empty());
+  list = MakeList({1, 2, 3, 4});
+  list.reverse();
+  EXPECT_EQ(list, MakeList({4, 3, 2, 1}));
+}
+TEST_F(TestForwardList, Remove) {
+  using List = decltype(abc_list_of_kitten);
+  auto list = MakeList({1, 2, 1, 3, 1, 1, 4});
+  const auto expected = std::vector<List>{MakeList({2, 3, 4}), MakeList({3})};
+  auto scope = abc::stats_scope<List>();
+  // The value may be an element itself:
+  EXPECT_EQ(list.remove(list.front()), 4);
+  EXPECT_EQ(list, expected[0]);
+  EXPECT_EQ(list.remove_if([](auto &x) { return x.Id() % 2 == 0; }), 2);
+  EXPECT_EQ(list, expected[1]);
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.allocations, 0);
+  EXPECT_EQ(delta.deallocations, 6);
+}
+TEST_F(TestForwardList, Unique) {
+  auto list = MakeList({});
+  EXPECT_EQ(list.unique(), 0);
+  list = MakeList({1, 1, 2, 2, 2, 1, 3, 3});
+  EXPECT_EQ(list.unique(), 4);
+  EXPECT_EQ(list, MakeList({1, 2, 1, 3}));
+  // Each element is compared with the first of its group:
+  list = MakeList({1, 2, 3, 4, 5, 11, 12});
+  EXPECT_EQ(list.unique([](auto &x, auto &y) { return y.Id() - x.Id() < 3; }),
+            4);
+  EXPECT_EQ(list, MakeList({1, 4, 11}));
+}
+TEST_F(TestForwardList, Performance) {
+  using List = decltype(abc_list_of_kitten);
+  constexpr int kSize = 1000000;
+  auto scope = abc::stats_scope<List>();
+  for (int i = 0; i != kSize; ++i) {
+    abc_list_of_kitten.emplace_front(i);
+  }
+  // One node per element, constructed in place:
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.allocations, kSize);
+  EXPECT_EQ(delta.copies, 0);
+  EXPECT_EQ(delta.moves, 0);
+  abc_list_of_kitten.clear();
+  delta = scope.delta();
+  EXPECT_EQ(delta.deallocations, kSize);
+  EXPECT_EQ(delta.destructions, kSize);
 }
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,161 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/mapped_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+class TestMappedVector : public ::testing::Test {
+ protected:
+  using Vector = abc::mapped_vector<int>;
+  std::string path = (std::filesystem::temp_directory_path() /
+      ("abc_mapped_vector_" + std::to_string(::getpid()))).string();
+
+  void TearDown() override { std::remove(path.c_str()); }
+  // Save `0, 1, ..., n - 1` into a new file.
+  void Save(int n) {
+    std::remove(path.c_str());
+    auto v = Vector(path, abc::map_mode::kReadWrite);
+    for (int i = 0; i != n; ++i) {
+      v.push_back(i);
+    }
+  }
+  static void ExpectFilled(const Vector &v, int n) {
+    ASSERT_EQ(v.size(), n);
+    for (int i = 0; i != n; ++i) {
+      ASSERT_EQ(v[i], i);
+    }
+  }
+};
+TEST_F(TestMappedVector, GrowAndReopen) {
+  {
+    auto v = Vector(path, abc::map_mode::kReadWrite);
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 0);
+    for (int i = 0; i != 100000; ++i) {
+      v.emplace_back(i);
+    }
+    EXPECT_GE(v.capacity(), v.size());
+    v.flush();
+  }
+  auto v = Vector(path, abc::map_mode::kReadOnly);
+  ExpectFilled(v, 100000);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_EQ(v.back(), 99999);
+  EXPECT_EQ(v.at(7), 7);
+  EXPECT_THROW(v.at(100000), std::out_of_range);
+  // Reopened for writing, it keeps growing from where it stopped:
+  auto w = Vector(path, abc::map_mode::kReadWrite);
+  ExpectFilled(w, 100000);
+  w.push_back(100000);
+  ExpectFilled(w, 100001);
+}
+TEST_F(TestMappedVector, Resize) {
+  auto v = Vector(path, abc::map_mode::kReadWrite);
+  v.resize(10, 7);
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(v.back(), 7);
+  v.resize(3);
+  v.pop_back();
+  EXPECT_EQ(v.size(), 2);
+  v.reserve(1000);
+  EXPECT_EQ(v.capacity(), 1000);
+  EXPECT_EQ(std::filesystem::file_size(path), 64 + 1000 * sizeof(int));
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 2);
+  EXPECT_EQ(std::filesystem::file_size(path), 64 + 2 * sizeof(int));
+  auto source = abc::vector<int>{3, 1, 4, 1, 5};
+  v.assign(source.begin(), source.end());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), source.begin(), source.end()));
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+TEST_F(TestMappedVector, TooLarge) {
+  Save(1000);
+  auto bytes = std::filesystem::file_size(path);
+  {
+    auto v = Vector(path, abc::map_mode::kReadWrite);
+    // `64 + n * sizeof(int)` would wrap around:
+    EXPECT_THROW(v.reserve(SIZE_MAX / 4), std::length_error);
+    EXPECT_THROW(v.reserve(Vector::max_size() + 1), std::length_error);
+    EXPECT_THROW(v.resize(SIZE_MAX / 4), std::length_error);
+    ExpectFilled(v, 1000);
+  }
+  EXPECT_EQ(std::filesystem::file_size(path), bytes);
+  ExpectFilled(Vector(path, abc::map_mode::kReadOnly), 1000);
+}
+TEST_F(TestMappedVector, GrowFromOwnElement) {
+  // The old mapping is gone once the vector grows, so the arguments must be
+  // read before that:
+  auto v = Vector(path, abc::map_mode::kReadWrite);
+  v.push_back(7);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.size(), v.capacity());
+  v.push_back(v[0]);
+  EXPECT_EQ(v[1], 7);
+  v.shrink_to_fit();
+  v.emplace_back(v.back());
+  EXPECT_EQ(v[2], 7);
+  v.shrink_to_fit();
+  v.resize(10, v.front());
+  EXPECT_EQ(v.back(), 7);
+}
+TEST_F(TestMappedVector, CopyOnWrite) {
+  Save(100);
+  {
+    auto v = Vector(path, abc::map_mode::kCopyOnWrite);
+    v[0] = -1;
+    EXPECT_EQ(v[0], -1);
+    // A private mapping cannot grow the file:
+    EXPECT_THROW(v.push_back(100), std::logic_error);
+    EXPECT_THROW(v.reserve(1000), std::logic_error);
+    auto r = Vector(path, abc::map_mode::kReadOnly);
+    EXPECT_THROW(r.clear(), std::logic_error);
+    EXPECT_NE(v, r);
+  }
+  ExpectFilled(Vector(path, abc::map_mode::kReadOnly), 100);
+}
+TEST_F(TestMappedVector, Move) {
+  Save(10);
+  auto v = Vector(path, abc::map_mode::kReadOnly);
+  auto u = std::move(v);
+  ExpectFilled(u, 10);
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 0);
+  v = std::move(u);
+  EXPECT_TRUE(u.empty());
+  ExpectFilled(v, 10);
+  EXPECT_EQ(v.mode(), abc::map_mode::kReadOnly);
+}
+TEST_F(TestMappedVector, CheckHeader) {
+  EXPECT_THROW(Vector(path, abc::map_mode::kReadOnly), std::system_error);
+  Save(10);
+  // The element type must match:
+  EXPECT_THROW((abc::mapped_vector<int64_t>(path, abc::map_mode::kReadOnly)),
+               std::runtime_error);
+  EXPECT_NO_THROW((abc::mapped_vector<float>(path,
+                                             abc::map_mode::kReadOnly)));
+  // The file must be long enough for its size:
+  std::filesystem::resize_file(path, 64 + 9 * sizeof(int));
+  EXPECT_THROW(Vector(path, abc::map_mode::kReadOnly), std::runtime_error);
+  // And it must hold a header:
+  std::ofstream(path) << "not a vector";
+  EXPECT_THROW(Vector(path, abc::map_mode::kReadWrite), std::runtime_error);
+  std::ofstream(path) << std::string(64, 'x');
+  EXPECT_THROW(Vector(path, abc::map_mode::kCopyOnWrite), std::runtime_error);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,234 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/memory_resource.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+class TestMemoryResource : public ::testing::Test {
+ protected:
+  // A resource counting the bytes (and the blocks) in use.
+  class Counting : public abc::memory_resource {
+   public:
+    std::size_t bytes{0};
+    std::size_t blocks{0};
+
+   private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+      this->bytes += bytes;
+      ++blocks;
+      return abc::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void *p, std::size_t bytes,
+                       std::size_t alignment) override {
+      this->bytes -= bytes;
+      --blocks;
+      abc::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const memory_resource &that) const noexcept override {
+      return this == &that;
+    }
+  };
+  // common data
+  Counting upstream;
+  // common operations
+  static bool IsAligned(void *p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+  }
+};
+TEST_F(TestMemoryResource, DefaultResource) {
+  EXPECT_EQ(abc::get_default_resource(), abc::new_delete_resource());
+  auto previous = abc::set_default_resource(&upstream);
+  EXPECT_EQ(previous, abc::new_delete_resource());
+  EXPECT_EQ(abc::get_default_resource(), &upstream);
+  EXPECT_EQ(abc::polymorphic_allocator<int>().resource(), &upstream);
+  abc::set_default_resource(nullptr);
+  EXPECT_EQ(abc::get_default_resource(), abc::new_delete_resource());
+  EXPECT_THROW(abc::null_memory_resource()->allocate(1), std::bad_alloc);
+}
+TEST_F(TestMemoryResource, MonotonicOnStackBuffer) {
+  alignas(std::max_align_t) char buffer[256];
+  auto resource = abc::monotonic_buffer_resource(
+      buffer, sizeof(buffer), abc::null_memory_resource());
+  auto p = resource.allocate(1, 1);
+  EXPECT_EQ(p, buffer);
+  auto q = resource.allocate(8, 8);
+  EXPECT_EQ(q, buffer + 8);
+  resource.deallocate(q, 8, 8);  // no effect
+  auto r = resource.allocate(16, 16);
+  EXPECT_TRUE(IsAligned(r, 16));
+  EXPECT_EQ(r, buffer + 16);
+  // the buffer is exhausted, and upstream has nothing:
+  EXPECT_THROW(resource.allocate(256, 1), std::bad_alloc);
+  // release() restarts from the beginning of the buffer:
+  resource.release();
+  EXPECT_EQ(resource.allocate(1, 1), buffer);
+}
+TEST_F(TestMemoryResource, MonotonicGrowsGeometrically) {
+  {
+    alignas(std::max_align_t) char buffer[64];
+    auto resource = abc::monotonic_buffer_resource(
+        buffer, sizeof(buffer), &upstream);
+    for (int i = 0; i != 1 << 16; ++i) {
+      auto p = static_cast<int *>(resource.allocate(sizeof(int),
+                                                    alignof(int)));
+      EXPECT_TRUE(IsAligned(p, alignof(int)));
+      *p = i;
+    }
+    EXPECT_LT(upstream.blocks, 16);
+    // over-aligned requests are supported:
+    EXPECT_TRUE(IsAligned(resource.allocate(3, 64), 64));
+    resource.release();
+    EXPECT_EQ(upstream.bytes, 0);
+    resource.allocate(1 << 20);
+    EXPECT_GE(upstream.bytes, 1 << 20);
+  }
+  EXPECT_EQ(upstream.bytes, 0);
+}
+TEST_F(TestMemoryResource, UnsynchronizedPool) {
+  {
+    auto resource = abc::unsynchronized_pool_resource(
+        abc::pool_options{64, 256}, &upstream);
+    EXPECT_EQ(resource.options().max_blocks_per_chunk, 64);
+    EXPECT_EQ(resource.options().largest_required_pool_block, 256);
+    // blocks are recycled by their size class:
+    auto p = resource.allocate(24, 8);
+    resource.deallocate(p, 24, 8);
+    EXPECT_EQ(resource.allocate(32, 8), p);
+    EXPECT_NE(resource.allocate(32, 8), p);
+    // blocks are aligned:
+    for (std::size_t alignment = 1; alignment <= 256; alignment *= 2) {
+      for (std::size_t bytes = 1; bytes <= 300; bytes += 7) {
+        auto q = resource.allocate(bytes, alignment);
+        EXPECT_TRUE(IsAligned(q, alignment)) << bytes << ' ' << alignment;
+      }
+    }
+    // large blocks are returned to upstream at once:
+    auto bytes = upstream.bytes;
+    auto large = resource.allocate(1000, 128);
+    EXPECT_TRUE(IsAligned(large, 128));
+    EXPECT_GT(upstream.bytes, bytes + 1000);
+    resource.deallocate(large, 1000, 128);
+    EXPECT_EQ(upstream.bytes, bytes);
+    resource.allocate(1000, 128);
+    resource.release();
+    EXPECT_EQ(upstream.bytes, 0);
+    resource.allocate(8);
+  }
+  EXPECT_EQ(upstream.bytes, 0);
+}
+TEST_F(TestMemoryResource, SynchronizedPool) {
+  {
+    auto resource = abc::synchronized_pool_resource(&upstream);
+    auto run = [&resource](int seed) {
+      auto blocks = std::vector<int *>();
+      for (int i = 0; i != 10000; ++i) {
+        auto p = static_cast<int *>(resource.allocate(sizeof(int) * (i % 9)));
+        blocks.emplace_back(p);
+        if (i % 9) {
+          *p = seed;
+        }
+        if (i % 3 == 0) {
+          auto j = blocks.size() - 1;
+          if (j % 9) {
+            EXPECT_EQ(*blocks[j], seed);
+          }
+        }
+      }
+      for (std::size_t i = 0; i != blocks.size(); ++i) {
+        resource.deallocate(blocks[i], sizeof(int) * (i % 9));
+      }
+    };
+    auto threads = std::vector<std::thread>();
+    for (int i = 0; i != 4; ++i) {
+      threads.emplace_back(run, i);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  EXPECT_EQ(upstream.bytes, 0);
+}
+TEST_F(TestMemoryResource, PolymorphicAllocatorWithVector) {
+  using Kitten = abc::data::Copyable;
+  using Vector = abc::vector<Kitten, abc::polymorphic_allocator<Kitten>>;
+  auto pool = abc::unsynchronized_pool_resource(&upstream);
+  {
+    auto kittens = Vector(&pool);
+    for (int i = 0; i != 1000; ++i) {
+      kittens.emplace_back(i);
+    }
+    for (int i = 0; i != 1000; ++i) {
+      EXPECT_EQ(kittens[i], Kitten(i));
+    }
+    EXPECT_EQ(kittens.get_allocator().resource(), &pool);
+    EXPECT_GT(upstream.bytes, 0);
+    // a copy uses the default resource:
+    auto copied = kittens;
+    EXPECT_EQ(copied.get_allocator().resource(),
+              abc::get_default_resource());
+    EXPECT_EQ(copied, kittens);
+    // move assignment between different resources moves element-wise:
+    alignas(std::max_align_t) char buffer[1024];
+    auto arena = abc::monotonic_buffer_resource(buffer, sizeof(buffer));
+    auto moved = Vector(&arena);
+    moved = abc::move(copied);
+    EXPECT_EQ(moved.get_allocator().resource(), &arena);
+    EXPECT_EQ(moved, kittens);
+    // a failed allocation leaves the old array in place:
+    alignas(std::max_align_t) char two_kittens[sizeof(Kitten) * 2];
+    auto small = abc::monotonic_buffer_resource(
+        two_kittens, sizeof(two_kittens), abc::null_memory_resource());
+    auto full = Vector(&small);
+    full.reserve(2);
+    EXPECT_THROW(full = abc::move(moved), std::bad_alloc);
+    EXPECT_TRUE(full.empty());
+    EXPECT_EQ(full.capacity(), 2);
+    full.emplace_back(1);
+    EXPECT_EQ(full.back(), Kitten(1));
+  }
+  pool.release();
+  EXPECT_EQ(upstream.bytes, 0);
+}
+TEST_F(TestMemoryResource, PoolAllocator) {
+  {
+    auto alloc = abc::pool_allocator<double>(&upstream);
+    auto rebound = abc::pool_allocator<char>(alloc);
+    EXPECT_EQ(alloc, rebound);
+    EXPECT_NE(alloc, abc::pool_allocator<double>(&upstream));
+    // single objects are carved from chunks:
+    auto p = alloc.allocate(1);
+    auto q = alloc.allocate(1);
+    EXPECT_EQ(q, p + 1);
+    EXPECT_EQ(upstream.blocks, 1);
+    // and recycled:
+    alloc.deallocate(p, 1);
+    EXPECT_EQ(alloc.allocate(1), p);
+    // objects of the same size share a pool:
+    auto r = abc::pool_allocator<std::int64_t>(rebound).allocate(1);
+    EXPECT_EQ(static_cast<void *>(r), static_cast<void *>(q + 1));
+    // arrays are forwarded to upstream:
+    auto array = alloc.allocate(100);
+    EXPECT_EQ(upstream.blocks, 2);
+    alloc.deallocate(array, 100);
+    EXPECT_EQ(upstream.blocks, 1);
+    // a moved-from allocator still shares the pools:
+    auto moved = std::move(rebound);
+    EXPECT_EQ(moved, rebound);
+    rebound.deallocate(rebound.allocate(1), 1);
+  }
+  // the last copy returns all chunks:
+  EXPECT_EQ(upstream.bytes, 0);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
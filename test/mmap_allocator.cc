@@ -0,0 +1,120 @@
+// Copyright 2026 Weicheng Pei
+#define ABC_ENABLE_STATS  // count relocated bytes
+#include "abc/mmap_allocator.h"
+
+#include <cstdint>
+#include <new>
+
+#include "abc/data/copyable.h"
+#include "abc/small_vector.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+class TestMmapAllocator : public ::testing::Test {
+ protected:
+  // Map blocks of at least 4 KiB, so that tests stay small:
+  static constexpr std::size_t kThreshold = 4096;
+  template <class T>
+  using Allocator = abc::mmap_allocator<T, kThreshold>;
+  static constexpr int kMapped = kThreshold / sizeof(int);
+  // common operations
+  static void Fill(int *p, int n) {
+    for (int i = 0; i != n; ++i) {
+      p[i] = i;
+    }
+  }
+  static void ExpectFilled(const int *p, int n) {
+    for (int i = 0; i != n; ++i) {
+      ASSERT_EQ(p[i], i);
+    }
+  }
+};
+TEST_F(TestMmapAllocator, AllocateAndDeallocate) {
+  auto alloc = Allocator<int>();
+  for (int n : {1, 100, kMapped - 1, kMapped, 100 * kMapped}) {
+    auto p = alloc.allocate(n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(int), 0);
+    Fill(p, n);
+    ExpectFilled(p, n);
+    alloc.deallocate(p, n);
+  }
+  EXPECT_EQ(alloc, Allocator<double>(alloc));
+  // `n * sizeof(int)` would overflow:
+  EXPECT_THROW(alloc.allocate(alloc.max_size() + 1),
+               std::bad_array_new_length);
+}
+TEST_F(TestMmapAllocator, Reallocate) {
+  auto alloc = Allocator<int>();
+  // grow from malloc'ed to mapped blocks:
+  auto n = 10;
+  auto p = alloc.allocate(n);
+  Fill(p, n);
+  for (auto new_n : {100, kMapped, 10 * kMapped, 1000 * kMapped}) {
+    p = alloc.reallocate(p, n, new_n);
+    ExpectFilled(p, n);
+    Fill(p, new_n);
+    n = new_n;
+  }
+  // shrink back:
+  for (auto new_n : {10 * kMapped, kMapped - 1, 10}) {
+    p = alloc.reallocate(p, n, new_n);
+    ExpectFilled(p, new_n);
+    n = new_n;
+  }
+  // An overflowing size leaves the block as it was:
+  EXPECT_THROW(alloc.reallocate(p, n, alloc.max_size() + 1),
+               std::bad_array_new_length);
+  ExpectFilled(p, n);
+  alloc.deallocate(p, n);
+}
+TEST_F(TestMmapAllocator, VectorGrowsInPlace) {
+  using Vector = abc::vector<int, Allocator<int>>;
+  auto scope = abc::stats_scope<Vector>();
+  auto v = Vector();
+  for (int i = 0; i != 100 * kMapped; ++i) {
+    v.emplace_back(i);
+  }
+  v.resize(1000 * kMapped, v.back());
+  EXPECT_EQ(v.back(), 100 * kMapped - 1);
+  while (v.size() > kMapped / 2) {
+    v.pop_back();
+  }
+  ExpectFilled(v.data(), v.size());
+  // blocks are resized, but no element is copied:
+  auto delta = scope.delta();
+  EXPECT_GT(delta.reallocations, 10);
+  EXPECT_EQ(delta.allocations, 1);
+  EXPECT_EQ(delta.bytes_relocated, 0);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), v.size());
+  ExpectFilled(v.data(), v.size());
+}
+TEST_F(TestMmapAllocator, SmallVectorGrowsInPlace) {
+  using Vector = abc::small_vector<int, 16, Allocator<int>>;
+  auto scope = abc::stats_scope<Vector>();
+  auto v = Vector();
+  for (int i = 0; i != 10 * kMapped; ++i) {
+    v.emplace_back(i);
+  }
+  ExpectFilled(v.data(), v.size());
+  // only the inline elements are relocated:
+  EXPECT_EQ(scope.delta().bytes_relocated, 16 * sizeof(int));
+}
+TEST_F(TestMmapAllocator, NonRelocatableFallsBack) {
+  using Kitten = abc::data::Copyable;
+  using Vector = abc::vector<Kitten, Allocator<Kitten>>;
+  auto scope = abc::stats_scope<Vector>();
+  auto v = Vector();
+  for (int i = 0; i != kMapped; ++i) {
+    v.emplace_back(i);
+  }
+  for (int i = 0; i != kMapped; ++i) {
+    ASSERT_EQ(v[i], Kitten(i));
+  }
+  EXPECT_EQ(scope.delta().moves, kMapped - 1);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count destructions, see `Destruction`
+#include "abc/mpmc_ring.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+TEST(TestMpmcRing, Sequential) {
+  auto ring = abc::mpmc_ring<abc::data::MoveOnly>(3);
+  EXPECT_EQ(ring.capacity(), 4);
+  EXPECT_TRUE(ring.empty());
+  EXPECT_FALSE(ring.try_pop());
+  for (int i = 0; i != 4; ++i) {
+    EXPECT_TRUE(ring.try_emplace(i));
+  }
+  EXPECT_FALSE(ring.try_push(abc::data::MoveOnly(4)));
+  EXPECT_EQ(ring.size(), 4);
+  // Wrap around the end of the slots:
+  for (int i = 0; i != 20; ++i) {
+    auto front = ring.try_pop();
+    ASSERT_TRUE(front);
+    EXPECT_EQ(front->Id(), i);
+    EXPECT_TRUE(ring.try_emplace(i + 4));
+  }
+  EXPECT_EQ(ring.size(), 4);
+}
+TEST(TestMpmcRing, ThrowingConstructor) {
+  // A throwing constructor runs before a slot is claimed:
+  struct Picky {
+    int value;
+    explicit Picky(int v) : value(v) {
+      if (v < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+  };
+  auto ring = abc::mpmc_ring<Picky>(2);
+  EXPECT_TRUE(ring.try_emplace(1));
+  EXPECT_THROW(ring.try_emplace(-1), std::invalid_argument);
+  EXPECT_TRUE(ring.try_emplace(2));
+  EXPECT_EQ(ring.try_pop()->value, 1);
+  EXPECT_EQ(ring.try_pop()->value, 2);
+  EXPECT_FALSE(ring.try_pop());
+}
+TEST(TestMpmcRing, Concurrent) {
+  // Every value pushed is popped exactly once, and the values pushed by
+  // one producer are popped in order by each consumer:
+  constexpr int kProducers = 4, kConsumers = 4, kPerProducer = 50000;
+  auto ring = abc::mpmc_ring<int>(64);
+  auto popped = std::vector<std::atomic<int>>(kProducers * kPerProducer);
+  auto remaining = std::atomic<int>(kProducers * kPerProducer);
+  auto threads = std::vector<std::thread>();
+  for (int t = 0; t != kProducers; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i != kPerProducer; ) {
+        if (ring.try_push(t * kPerProducer + i)) {
+          ++i;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  auto in_order = std::atomic<bool>(true);
+  for (int t = 0; t != kConsumers; ++t) {
+    threads.emplace_back([&] {
+      auto last = std::vector<int>(kProducers, -1);
+      while (remaining.load() > 0) {
+        if (auto front = ring.try_pop()) {
+          ++popped[*front];
+          --remaining;
+          auto &prev = last[*front / kPerProducer];
+          in_order = in_order && prev < *front;
+          prev = *front;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(ring.empty());
+  for (auto &count : popped) {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+TEST(TestMpmcRing, Destruction) {
+  // The elements left in the ring are destroyed with it:
+  using Ring = abc::mpmc_ring<abc::data::MoveOnly>;
+  auto scope = abc::stats_scope<Ring>();
+  {
+    auto ring = Ring(4);
+    ring.try_emplace(1);
+    ring.try_emplace(2);
+    ring.try_pop();
+    ring.try_emplace(3);
+  }
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.destructions, 3);
+  EXPECT_EQ(delta.deallocations, delta.allocations);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
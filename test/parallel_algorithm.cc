@@ -0,0 +1,111 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/parallel_algorithm.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "abc/execution.h"
+#include "abc/thread_pool.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+class TestParallelAlgorithm : public ::testing::Test {
+ protected:
+  // Long enough to be split into several chunks:
+  static constexpr int kSize = 1000003;
+  abc::thread_pool pool{3};
+  abc::execution::parallel_policy par = abc::execution::par.on(pool);
+  abc::vector<int64_t> v = [] {
+    auto v = abc::vector<int64_t>(kSize);
+    auto random = std::mt19937(42);
+    for (auto &x : v) {
+      x = random() % 1000;
+    }
+    return v;
+  }();
+  std::vector<int64_t> expected{v.begin(), v.end()};
+};
+TEST_F(TestParallelAlgorithm, ForEachAndTransform) {
+  abc::for_each(par, v.begin(), v.end(), [](int64_t &x) { x *= 2; });
+  std::for_each(expected.begin(), expected.end(), [](int64_t &x) { x *= 2; });
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  auto out = abc::vector<int64_t>(kSize);
+  auto square = [](int64_t x) { return x * x; };
+  EXPECT_EQ(abc::transform(par, v.begin(), v.end(), out.begin(), square),
+            out.end());
+  std::transform(expected.begin(), expected.end(), expected.begin(), square);
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  abc::transform(abc::execution::par_unseq.on(pool), v.begin(), v.end(),
+                 out.begin(), out.begin(), std::minus<>());
+  for (int i = 0; i != kSize; ++i) {
+    ASSERT_EQ(out[i], v[i] - expected[i]);
+  }
+}
+TEST_F(TestParallelAlgorithm, Copy) {
+  auto out = abc::vector<int64_t>(kSize);
+  EXPECT_EQ(abc::copy(par, v.begin(), v.end(), out.begin()), out.end());
+  EXPECT_EQ(out, v);
+}
+TEST_F(TestParallelAlgorithm, Reduce) {
+  auto sum = std::accumulate(expected.begin(), expected.end(), int64_t(7));
+  EXPECT_EQ(abc::reduce(par, v.begin(), v.end(), int64_t(7)), sum);
+  EXPECT_EQ(abc::reduce(par, v.begin(), v.end()), sum - 7);
+  EXPECT_EQ(abc::reduce(abc::execution::seq, v.begin(), v.end()), sum - 7);
+  auto max = *std::max_element(expected.begin(), expected.end());
+  EXPECT_EQ(abc::reduce(par, v.begin(), v.end(), int64_t(-1),
+                        [](int64_t a, int64_t b) { return std::max(a, b); }),
+            max);
+  EXPECT_EQ(abc::transform_reduce(par, v.begin(), v.end(), v.begin(),
+                                  int64_t(0)),
+            std::inner_product(expected.begin(), expected.end(),
+                               expected.begin(), int64_t(0)));
+  // Empty ranges return `init`:
+  EXPECT_EQ(abc::reduce(par, v.begin(), v.begin(), int64_t(7)), 7);
+}
+TEST_F(TestParallelAlgorithm, InclusiveScan) {
+  auto out = abc::vector<int64_t>(kSize);
+  std::inclusive_scan(expected.begin(), expected.end(), expected.begin());
+  EXPECT_EQ(abc::inclusive_scan(par, v.begin(), v.end(), out.begin()),
+            out.end());
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  // in place, with `init`:
+  abc::inclusive_scan(par, v.begin(), v.end(), v.begin(), std::plus<>(),
+                      int64_t(100));
+  for (int i = 0; i != kSize; ++i) {
+    ASSERT_EQ(v[i], expected[i] + 100);
+  }
+  // `op` must be associative, but needs not be commutative:
+  auto words = abc::vector<std::string>(100000, "a");
+  words[0] = "b";
+  auto scanned = abc::vector<std::string>(words.size());
+  abc::inclusive_scan(par, words.begin(), words.end(), scanned.begin(),
+                      [](const std::string &a, const std::string &b) {
+                        return (a + b).substr(0, 3);
+                      });
+  EXPECT_EQ(scanned.back(), "baa");
+}
+TEST_F(TestParallelAlgorithm, Sort) {
+  std::sort(expected.begin(), expected.end());
+  abc::sort(par, v.begin(), v.end());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  abc::sort(par, v.begin(), v.end(), std::greater<>());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.rbegin()));
+}
+TEST_F(TestParallelAlgorithm, Sequential) {
+  // Forward iterators and `seq` run on the calling thread:
+  auto list = std::forward_list<int>{3, 1, 2};
+  abc::for_each(par, list.begin(), list.end(), [](int &x) { x += 1; });
+  EXPECT_EQ(abc::reduce(par, list.begin(), list.end()), 9);
+  abc::sort(abc::execution::seq, v.begin(), v.end());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/serialize.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "abc/forward_list.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+// A user's serializer, for a type that is not trivially copyable:
+template <>
+struct abc::serializer<std::string> {
+  template <class Sink>
+  static void write(Sink &sink, const std::string &value) {
+    abc::serialize(sink, abc::vector<char>(value.begin(), value.end()));
+  }
+  template <class Source>
+  static void read(Source &source, std::string &value) {
+    auto chars = abc::deserialize<abc::vector<char>>(source);
+    value.assign(chars.begin(), chars.end());
+  }
+};
+
+class TestSerialize : public ::testing::Test {
+ protected:
+  // Write `value` into a buffer, and read it back.
+  template <class T>
+  static T RoundTrip(const T &value) {
+    auto sink = abc::buffer_sink();
+    abc::serialize(sink, value);
+    auto source = abc::buffer_source(sink.bytes());
+    auto copy = abc::deserialize<T>(source);
+    EXPECT_EQ(source.remaining(), 0);
+    return copy;
+  }
+  template <class List>
+  static bool Equal(const List &lhs, const List &rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+};
+TEST_F(TestSerialize, Vector) {
+  auto v = abc::vector<int>();
+  EXPECT_EQ(RoundTrip(v), v);
+  for (int i = 0; i != 1000; ++i) {
+    v.emplace_back(i * i);
+  }
+  EXPECT_EQ(RoundTrip(v), v);
+  // A length and the bytes of the elements:
+  auto sink = abc::buffer_sink();
+  abc::serialize(sink, v);
+  EXPECT_EQ(sink.bytes().size(), sizeof(std::uint64_t) + 1000 * sizeof(int));
+  auto doubles = abc::vector<double>{0.5, -1.0, 1e300};
+  EXPECT_EQ(RoundTrip(doubles), doubles);
+}
+TEST_F(TestSerialize, ForwardList) {
+  auto list = abc::forward_list<int>();
+  EXPECT_TRUE(RoundTrip(list).empty());
+  list = {3, 1, 4, 1, 5, 9, 2, 6};
+  EXPECT_TRUE(Equal(RoundTrip(list), list));
+  // A list and a vector of the same elements are written alike:
+  auto sink = abc::buffer_sink();
+  abc::serialize(sink, list);
+  auto source = abc::buffer_source(sink.bytes());
+  EXPECT_EQ(abc::deserialize<abc::vector<int>>(source),
+            (abc::vector<int>{3, 1, 4, 1, 5, 9, 2, 6}));
+}
+TEST_F(TestSerialize, Nested) {
+  auto table = abc::vector<abc::vector<int>>(3);
+  table[0] = {1, 2};
+  table[2] = {3, 4, 5};
+  EXPECT_EQ(RoundTrip(table), table);
+  auto lists = abc::vector<abc::forward_list<int>>(2);
+  lists[1] = {7, 8};
+  auto copy = RoundTrip(lists);
+  ASSERT_EQ(copy.size(), 2);
+  EXPECT_TRUE(copy[0].empty());
+  EXPECT_TRUE(Equal(copy[1], lists[1]));
+  auto words = abc::forward_list<std::string>{"flat", "", "map"};
+  EXPECT_TRUE(Equal(RoundTrip(words), words));
+}
+TEST_F(TestSerialize, Reuse) {
+  auto sink = abc::buffer_sink();
+  abc::serialize(sink, abc::vector<int>(100, 7));
+  // A vector that has reserved enough room is filled in place:
+  auto v = abc::vector<int>(5, 1);
+  v.reserve(200);
+  auto data = v.data();
+  auto source = abc::buffer_source(sink.bytes());
+  abc::deserialize(source, v);
+  EXPECT_EQ(v, abc::vector<int>(100, 7));
+  EXPECT_EQ(v.data(), data);
+}
+TEST_F(TestSerialize, CorruptInput) {
+  // A huge length fails at the end of the input, before exhausting memory:
+  auto sink = abc::buffer_sink();
+  abc::serialize(sink, std::numeric_limits<std::uint64_t>::max() / 8);
+  abc::serialize(sink, 42);
+  auto source = abc::buffer_source(sink.bytes());
+  auto v = abc::vector<int>();
+  EXPECT_THROW(abc::deserialize(source, v), std::runtime_error);
+  EXPECT_LE(v.capacity(), 1 << 20);
+  auto list = abc::forward_list<int>();
+  source = abc::buffer_source(sink.bytes());
+  EXPECT_THROW(abc::deserialize(source, list), std::runtime_error);
+}
+TEST_F(TestSerialize, FileDescriptor) {
+  auto path = (std::filesystem::temp_directory_path() /
+      ("abc_serialize_" + std::to_string(::getpid()))).string();
+  auto table = abc::vector<abc::vector<int>>();
+  for (int i = 0; i != 100; ++i) {
+    table.emplace_back(i * 10, i);
+  }
+  auto list = abc::forward_list<double>{1.5, 2.5};
+  {
+    auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    // A small buffer, so most writes are sent by `writev`:
+    auto sink = abc::fd_sink(fd, 16);
+    abc::serialize(sink, table);
+    abc::serialize(sink, list);
+    sink.flush();
+    ::close(fd);
+  }
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+  auto source = abc::fd_source(fd, 64);
+  EXPECT_EQ(abc::deserialize<decltype(table)>(source), table);
+  EXPECT_TRUE(Equal(abc::deserialize<decltype(list)>(source), list));
+  EXPECT_THROW(abc::deserialize<int>(source), std::runtime_error);
+  ::close(fd);
+  std::remove(path.c_str());
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
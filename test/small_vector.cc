@@ -0,0 +1,149 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/small_vector.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/data/stateful_allocator.h"
+#include "gtest/gtest.h"
+
+class TestSmallVector : public ::testing::Test {
+ protected:
+  // helper class
+  using Kitten = abc::data::Copyable;
+  using Allocator = abc::data::StatefulAllocator<int>;
+  using Vector = abc::small_vector<int, 4, Allocator>;
+  // common data
+  Allocator alloc;
+  // common operations
+  static bool IsInline(const Vector &v) {
+    auto data = reinterpret_cast<const char *>(v.data());
+    auto self = reinterpret_cast<const char *>(&v);
+    return self <= data && data < self + sizeof(v);
+  }
+};
+TEST_F(TestSmallVector, InlineThenSpill) {
+  auto v = Vector(alloc);
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i != 4; ++i) {
+    v.emplace_back(i);
+  }
+  EXPECT_TRUE(IsInline(v));
+  EXPECT_EQ(alloc.Bytes(), 0);
+  v.emplace_back(4);
+  EXPECT_FALSE(IsInline(v));
+  EXPECT_EQ(alloc.Bytes(), v.capacity() * sizeof(int));
+  for (int i = 0; i != 5; ++i) {
+    EXPECT_EQ(v[i], i);
+  }
+  // shrinking back to the inline storage returns the memory:
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(IsInline(v));
+  EXPECT_EQ(alloc.Bytes(), 0);
+  EXPECT_EQ(v, Vector({0, 1, 2, 3}));
+}
+TEST_F(TestSmallVector, SameInterfaceAsVector) {
+  auto abc_v = abc::small_vector<Kitten, 8>();
+  auto std_v = std::vector<Kitten>();
+  for (int i = 0; i != 20; ++i) {
+    abc_v.emplace_back(i);
+    std_v.emplace_back(i);
+  }
+  abc_v.resize(30, abc_v.front());
+  std_v.resize(30, std_v.front());
+  abc_v.resize(5);
+  std_v.resize(5);
+  EXPECT_TRUE(std::equal(abc_v.begin(), abc_v.end(),
+                         std_v.begin(), std_v.end()));
+  auto copied = abc_v;
+  EXPECT_EQ(copied, abc_v);
+  copied.pop_back();
+  EXPECT_NE(copied, abc_v);
+}
+TEST_F(TestSmallVector, MoveInline) {
+  // Non-trivially relocatable elements are moved one by one:
+  auto kittens = abc::small_vector<Kitten, 4>({Kitten(1), Kitten(2)});
+  auto moved_kittens = abc::move(kittens);
+  EXPECT_TRUE(kittens.empty());
+  EXPECT_EQ(moved_kittens.size(), 2);
+  EXPECT_EQ(moved_kittens.back(), Kitten(2));
+  // Trivially relocatable elements are copied by bytes:
+  using MoveOnly = abc::data::MoveOnly;
+  auto a = abc::small_vector<MoveOnly, 4>();
+  a.emplace_back(1);
+  a.emplace_back(2);
+  auto b = abc::small_vector<MoveOnly, 4>();
+  b.emplace_back(3);
+  b = abc::move(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 2);
+  EXPECT_EQ(b.front().Id(), 1);
+  // the moved-from vector is still usable:
+  a.emplace_back(4);
+  EXPECT_EQ(a.front().Id(), 4);
+}
+TEST_F(TestSmallVector, MoveSpilled) {
+  auto v = Vector(alloc);
+  for (int i = 0; i != 10; ++i) {
+    v.emplace_back(i);
+  }
+  // the heap block is stolen:
+  auto data = v.data();
+  auto moved = abc::move(v);
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_TRUE(IsInline(v));
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(alloc.Bytes(), moved.capacity() * sizeof(int));
+}
+TEST_F(TestSmallVector, Swap) {
+  auto a = Vector({1, 2}, alloc);
+  auto b = Vector({3, 4, 5, 6, 7}, alloc);
+  a.swap(b);
+  EXPECT_EQ(a, Vector({3, 4, 5, 6, 7}));
+  EXPECT_EQ(b, Vector({1, 2}));
+  EXPECT_TRUE(IsInline(b));
+  auto c = Vector({8}, alloc);
+  b.swap(c);
+  EXPECT_EQ(b, Vector({8}));
+  EXPECT_EQ(c, Vector({1, 2}));
+}
+TEST_F(TestSmallVector, ThrowingMove) {
+  struct Bomb {
+    explicit Bomb(bool armed) : armed(armed) {}
+    Bomb(Bomb &&that) : armed(that.armed) {
+      if (armed) {
+        throw std::runtime_error("moved");
+      }
+    }
+    bool armed;
+  };
+  using Bombs = abc::small_vector<Bomb, 2>;
+  // Only moving inline elements one by one may throw:
+  static_assert(std::is_nothrow_move_constructible_v<Vector>);
+  static_assert(std::is_nothrow_move_constructible_v<abc::vector<Bomb>>);
+  static_assert(!std::is_nothrow_move_constructible_v<Bombs>);
+  auto bombs = Bombs();
+  bombs.emplace_back(true);
+  EXPECT_THROW(Bombs(std::move(bombs)), std::runtime_error);
+  EXPECT_EQ(bombs.size(), 1);
+  EXPECT_TRUE(bombs.back().armed);
+}
+TEST_F(TestSmallVector, Size) {
+  // Only the inline storage is added to an abc::vector:
+  static_assert(sizeof(abc::small_vector<int, 0>) == sizeof(abc::vector<int>));
+  static_assert(sizeof(abc::small_vector<int, 4>) ==
+                sizeof(abc::vector<int>) + 4 * sizeof(int));
+  // An empty abc::vector allocates nothing:
+  EXPECT_EQ(abc::vector<int>().data(), nullptr);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,158 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count allocations, see `GrowInOneBlock`
+#include "abc/soa_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+class TestSoaVector : public ::testing::Test {
+ protected:
+  using Rows = abc::soa_vector<int, double, char>;
+  static bool IsAligned(const void *p) {
+    return reinterpret_cast<std::uintptr_t>(p) % 64 == 0;
+  }
+};
+TEST_F(TestSoaVector, EmplaceAndColumns) {
+  auto v = Rows();
+  EXPECT_TRUE(v.empty());
+  for (int i = 0; i != 100; ++i) {
+    auto [id, weight, tag] = v.emplace_back(i, i * 0.5, 'a' + i % 26);
+    EXPECT_EQ(id, i);
+    EXPECT_EQ(weight, i * 0.5);
+    EXPECT_EQ(tag, 'a' + i % 26);
+  }
+  EXPECT_EQ(v.size(), 100);
+  // Each column is contiguous and starts on a cache line:
+  auto ids = v.column<0>();
+  EXPECT_EQ(ids.size(), 100);
+  EXPECT_TRUE(IsAligned(v.data<0>()));
+  EXPECT_TRUE(IsAligned(v.data<1>()));
+  EXPECT_TRUE(IsAligned(v.data<2>()));
+  for (int i = 0; i != 100; ++i) {
+    ASSERT_EQ(ids[i], i);
+  }
+  for (auto &weight : v.column<1>()) {
+    weight *= 2;
+  }
+  EXPECT_EQ(std::get<1>(v[10]), 10.0);
+  // A row is a tuple of references:
+  auto [id, weight, tag] = v[3];
+  id = -3;
+  tag = 'z';
+  EXPECT_EQ(v.front(), std::make_tuple(0, 0.0, 'a'));
+  EXPECT_EQ(v.at(3), std::make_tuple(-3, 3.0, 'z'));
+  v[4] = std::make_tuple(-4, -4.0, 'y');
+  EXPECT_EQ(v.data<0>()[4], -4);
+  EXPECT_THROW(v.at(100), std::out_of_range);
+}
+TEST_F(TestSoaVector, Iterators) {
+  auto v = Rows{{1, 1.5, 'a'}, {2, 2.5, 'b'}, {3, 3.5, 'c'}};
+  EXPECT_EQ(v.end() - v.begin(), 3);
+  int sum = 0;
+  for (auto [id, weight, tag] : v) {
+    sum += id;
+    weight = id;
+  }
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(std::get<1>(v.back()), 3.0);
+  const auto &c = v;
+  auto iter = std::find_if(c.begin(), c.end(), [](auto row) {
+    return std::get<2>(row) == 'b';
+  });
+  EXPECT_EQ(iter - c.begin(), 1);
+  EXPECT_EQ(std::get<0>(*iter), 2);
+  EXPECT_EQ(std::get<0>(iter[1]), 3);
+  EXPECT_EQ(std::get<2>(*(v.end() - 1)), 'c');
+  Rows::const_iterator first = v.begin();
+  EXPECT_TRUE(first < iter && iter != c.end());
+}
+TEST_F(TestSoaVector, GrowInOneBlock) {
+  auto scope = abc::stats_scope<Rows>();
+  {
+    auto v = Rows();
+    v.reserve(1000);
+    for (int i = 0; i != 1000; ++i) {
+      v.emplace_back(i, i, 'x');
+    }
+    // One block for all columns:
+    EXPECT_EQ(scope.delta().allocations, 1);
+    v.emplace_back(0, 0, 'y');
+    EXPECT_EQ(scope.delta().allocations, 2);
+    EXPECT_EQ(scope.delta().reallocations, 1);
+    EXPECT_EQ(v.capacity(), 2000);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 1001);
+    EXPECT_EQ(std::get<0>(v[999]), 999);
+    EXPECT_EQ(v.back(), std::make_tuple(0, 0.0, 'y'));
+  }
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.allocations, delta.deallocations);
+  // The arguments may refer to the vector itself, even on growth:
+  auto v = Rows(1);
+  v.shrink_to_fit();
+  std::get<0>(v[0]) = 7;
+  v.emplace_back(std::get<0>(v[0]), 1.0, 'a');
+  EXPECT_EQ(std::get<0>(v[1]), 7);
+}
+TEST_F(TestSoaVector, NonTrivialFields) {
+  using Kitten = abc::data::Copyable;
+  using Puppy = abc::data::MoveOnly;
+  auto v = abc::soa_vector<std::string, Kitten, Puppy>();
+  for (int i = 0; i != 10; ++i) {
+    v.emplace_back(std::to_string(i), Kitten(i), Puppy(i));
+  }
+  auto moved = std::move(v);
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.size(), 10);
+  moved.erase(moved.begin() + 2);
+  EXPECT_EQ(moved.size(), 9);
+  EXPECT_EQ(std::get<0>(moved[2]), "3");
+  EXPECT_EQ(std::get<2>(moved[2]).Id(), 3);
+  moved.pop_back();
+  moved.resize(10);
+  EXPECT_EQ(std::get<0>(moved.back()), "");
+  EXPECT_EQ(std::get<1>(moved.back()).Id(), -1);
+  moved.resize(2);
+  EXPECT_EQ(std::get<1>(moved[1]).Id(), 1);
+  v = std::move(moved);
+  EXPECT_EQ(v.size(), 2);
+  auto copied = abc::soa_vector<std::string, Kitten>();
+  copied.emplace_back("a", Kitten(1));
+  auto copy = copied;
+  EXPECT_EQ(copy, copied);
+  std::get<0>(copy[0]) = "b";
+  EXPECT_NE(copy, copied);
+  copy = copied;
+  EXPECT_EQ(copy, copied);
+}
+TEST_F(TestSoaVector, ThrowingField) {
+  struct Bomb {
+    explicit Bomb(int i) {
+      if (i < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+  };
+  using Kitten = abc::data::Copyable;
+  auto v = abc::soa_vector<Kitten, Bomb>();
+  v.emplace_back(Kitten(1), 1);
+  // The first field is destroyed again, and the size is kept:
+  EXPECT_THROW(v.emplace_back(Kitten(2), -1), std::invalid_argument);
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_EQ(v.capacity(), 1);
+  EXPECT_EQ(std::get<0>(v[0]).Id(), 1);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count destructions, see `Destruction`
+#include "abc/spsc_ring.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+TEST(TestSpscRing, Sequential) {
+  auto ring = abc::spsc_ring<abc::data::MoveOnly>(5);
+  EXPECT_EQ(ring.capacity(), 8);
+  EXPECT_TRUE(ring.empty());
+  EXPECT_FALSE(ring.try_pop());
+  for (int i = 0; i != 8; ++i) {
+    EXPECT_TRUE(ring.try_emplace(i));
+  }
+  EXPECT_FALSE(ring.try_push(abc::data::MoveOnly(8)));
+  EXPECT_EQ(ring.size(), 8);
+  // Wrap around the end of the slots:
+  for (int i = 0; i != 20; ++i) {
+    auto front = ring.try_pop();
+    ASSERT_TRUE(front);
+    EXPECT_EQ(front->Id(), i);
+    EXPECT_TRUE(ring.try_emplace(i + 8));
+  }
+  EXPECT_EQ(ring.size(), 8);
+}
+TEST(TestSpscRing, Batch) {
+  auto ring = abc::spsc_ring<int>(8);
+  auto values = std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto rest = ring.try_push(values.begin(), values.end());
+  EXPECT_EQ(rest - values.begin(), 8);
+  auto popped = std::vector<int>();
+  EXPECT_EQ(ring.try_pop(std::back_inserter(popped), 3), 3);
+  EXPECT_EQ(popped, std::vector<int>({0, 1, 2}));
+  rest = ring.try_push(rest, values.end());
+  EXPECT_EQ(rest, values.end());
+  EXPECT_EQ(ring.try_pop(std::back_inserter(popped), 100), 7);
+  EXPECT_EQ(popped, values);
+  EXPECT_EQ(ring.try_pop(std::back_inserter(popped), 100), 0);
+}
+TEST(TestSpscRing, ThrowingBatchPop) {
+  struct Picky {
+    Picky &operator=(int x) {
+      if (x == 2) {
+        throw std::invalid_argument("2");
+      }
+      value = x;
+      return *this;
+    }
+    int value{-1};
+  };
+  auto ring = abc::spsc_ring<int>(8);
+  for (int i = 0; i != 5; ++i) {
+    ring.try_emplace(i);
+  }
+  Picky batch[5];
+  EXPECT_THROW(ring.try_pop(batch, 5), std::invalid_argument);
+  EXPECT_EQ(batch[1].value, 1);
+  // The popped elements have left the ring, and the others are kept:
+  EXPECT_EQ(ring.size(), 3);
+  EXPECT_EQ(ring.try_pop(), 2);
+}
+TEST(TestSpscRing, Concurrent) {
+  // The consumer sees every value once, in the order pushed:
+  constexpr int kCount = 200000;
+  auto ring = abc::spsc_ring<int>(64);
+  auto producer = std::thread([&] {
+    for (int i = 0; i != kCount; ) {
+      if (ring.size() == ring.capacity()) {
+        std::this_thread::yield();
+      } else if (i % 3) {
+        i += ring.try_emplace(i);
+      } else {
+        int batch[] = {i, i + 1, i + 2};
+        auto end = std::begin(batch) + std::min(3, kCount - i);
+        i += ring.try_push(std::begin(batch), end) - std::begin(batch);
+      }
+    }
+  });
+  int expected = 0;
+  while (expected != kCount) {
+    if (ring.empty()) {
+      std::this_thread::yield();
+    } else if (expected % 2) {
+      int batch[5];
+      auto n = ring.try_pop(batch, 5);
+      for (std::size_t i = 0; i != n; ++i) {
+        ASSERT_EQ(batch[i], expected++);
+      }
+    } else if (auto front = ring.try_pop()) {
+      ASSERT_EQ(*front, expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ring.empty());
+}
+TEST(TestSpscRing, Destruction) {
+  // The elements left in the ring are destroyed with it:
+  using Ring = abc::spsc_ring<abc::data::MoveOnly>;
+  auto scope = abc::stats_scope<Ring>();
+  {
+    auto ring = Ring(4);
+    ring.try_emplace(1);
+    ring.try_emplace(2);
+    ring.try_pop();
+    ring.try_emplace(3);
+  }
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.destructions, 3);
+  EXPECT_EQ(delta.deallocations, delta.allocations);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/static_vector.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+// Built and filled at compile time.
+constexpr abc::static_vector<int, 8> Squares(int n) {
+  auto squares = abc::static_vector<int, 8>();
+  for (int i = 0; i != n; ++i) {
+    squares.emplace_back(i * i);
+  }
+  squares.pop_back();
+  return squares;
+}
+constexpr auto kSquares = Squares(5);
+static_assert(kSquares.size() == 4 && kSquares.back() == 9);
+static_assert(abc::static_vector<char, 4>(3, 'x')[2] == 'x');
+
+}  // namespace
+
+class TestStaticVector : public ::testing::Test {
+ protected:
+  using Kitten = abc::data::Copyable;
+  using Puppy = abc::data::MoveOnly;
+  struct Header {
+    std::uint16_t id;
+    std::uint16_t length;
+  };
+  struct Point {  // trivially copyable, but not trivial
+    Point() : x(-1), y(-1) {}
+    Point(int x, int y) : x(x), y(y) {}
+    int x, y;
+  };
+};
+TEST_F(TestStaticVector, NoHeap) {
+  using Headers = abc::static_vector<Header, 16>;
+  // The elements are inside the object, which is copied by bytes:
+  static_assert(sizeof(Headers) == sizeof(std::size_t) + 16 * sizeof(Header));
+  static_assert(std::is_trivially_copyable_v<Headers>);
+  static_assert(std::is_trivially_destructible_v<Headers>);
+  static_assert(std::is_trivially_copyable_v<abc::static_vector<Point, 4>>);
+  static_assert(!std::is_trivially_copyable_v<
+      abc::static_vector<Kitten, 4>>);
+  auto headers = Headers();
+  for (std::uint16_t i = 0; i != 16; ++i) {
+    headers.push_back({i, 20});
+  }
+  EXPECT_TRUE(headers.full());
+  auto *first = reinterpret_cast<const char *>(&headers);
+  auto *last = first + sizeof(headers);
+  EXPECT_TRUE(reinterpret_cast<const char *>(headers.begin()) >= first &&
+              reinterpret_cast<const char *>(headers.end()) <= last);
+  auto copy = headers;
+  EXPECT_EQ(copy[15].id, 15);
+  auto points = abc::static_vector<Point, 4>(2);
+  EXPECT_EQ(points.back().x, -1);
+  points.emplace_back(1, 2);
+  auto copied_points = points;
+  EXPECT_EQ(copied_points.back().y, 2);
+}
+TEST_F(TestStaticVector, Capacity) {
+  auto v = abc::static_vector<int, 4>{1, 2, 3};
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(v.emplace_back(4), 4);
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.emplace_back(5), std::length_error);
+  EXPECT_THROW(v.resize(5), std::length_error);
+  EXPECT_THROW(v.reserve(5), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), 0), std::length_error);
+  EXPECT_EQ(v.try_emplace_back(5), nullptr);
+  EXPECT_EQ(v.size(), 4);
+  v.pop_back();
+  EXPECT_EQ(*v.try_emplace_back(5), 5);
+  EXPECT_THROW((abc::static_vector<int, 2>{1, 2, 3}), std::length_error);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+}
+TEST_F(TestStaticVector, Modifiers) {
+  auto v = abc::static_vector<std::string, 8>{"b", "d"};
+  v.insert(v.begin(), "a");
+  v.emplace(v.begin() + 2, 1, 'c');
+  v.insert(v.end(), std::string("e"));
+  EXPECT_EQ(v, (abc::static_vector<std::string, 8>{"a", "b", "c", "d", "e"}));
+  EXPECT_EQ(*v.erase(v.begin() + 1), "c");
+  auto iter = v.erase(v.begin() + 2, v.end());
+  EXPECT_EQ(iter, v.end());
+  EXPECT_EQ(v, (abc::static_vector<std::string, 8>{"a", "c"}));
+  v.resize(4, "z");
+  EXPECT_EQ(v.back(), "z");
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1);
+  v.assign(3, "y");
+  EXPECT_EQ(v.front(), "y");
+  v = {"p", "q"};
+  EXPECT_LT(v, (abc::static_vector<std::string, 8>{"p", "r"}));
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+TEST_F(TestStaticVector, CopyAndMove) {
+  auto kittens = abc::static_vector<Kitten, 4>();
+  kittens.emplace_back(1);
+  kittens.emplace_back(2);
+  auto copy = kittens;
+  EXPECT_EQ(copy, kittens);
+  copy.emplace_back(3);
+  kittens = copy;
+  EXPECT_EQ(kittens.back().Id(), 3);
+  copy.resize(1);
+  kittens = copy;  // destroys the extra elements
+  EXPECT_EQ(kittens.size(), 1);
+  auto puppies = abc::static_vector<Puppy, 4>();
+  puppies.emplace_back(1);
+  puppies.emplace_back(2);
+  auto moved = std::move(puppies);
+  EXPECT_EQ(moved.back().Id(), 2);
+  EXPECT_EQ(puppies.size(), 2);  // the elements are moved-from
+  EXPECT_EQ(puppies.back().Id(), -1);
+  puppies = std::move(moved);
+  EXPECT_EQ(puppies.front().Id(), 1);
+  moved.clear();
+  moved.emplace_back(7);
+  swap(moved, puppies);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(puppies.size(), 1);
+  EXPECT_EQ(moved.back().Id(), 2);
+  EXPECT_EQ(puppies.back().Id(), 7);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
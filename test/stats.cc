@@ -0,0 +1,116 @@
+// Copyright 2026 Weicheng Pei
+#define ABC_ENABLE_STATS
+#include "abc/stats.h"
+
+#include <string>
+#include <typeinfo>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/forward_list.h"
+#include "abc/small_vector.h"
+#include "abc/vector.h"
+#include "gtest/gtest.h"
+
+class TestStats : public ::testing::Test {
+ protected:
+  // helper classes
+  using Kitten = abc::data::Copyable;
+  using MoveOnly = abc::data::MoveOnly;
+};
+TEST_F(TestStats, Enabled) {
+  static_assert(abc::kStatsEnabled);
+}
+TEST_F(TestStats, Vector) {
+  using Vector = abc::vector<Kitten>;
+  auto scope = abc::stats_scope<Vector>();
+  {
+    auto v = Vector();
+    auto kitten = Kitten(0);
+    v.push_back(kitten);             // copy, allocate 1
+    v.push_back(Kitten(1));          // move, reallocate to 2
+    v.emplace_back(2);               // neither, reallocate to 4
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.allocations, 3);
+    EXPECT_EQ(delta.deallocations, 2);
+    EXPECT_EQ(delta.reallocations, 3);
+    EXPECT_EQ(delta.copies, 1);
+    // 1 + 2 elements are moved, and then destroyed, by reallocations:
+    EXPECT_EQ(delta.moves, 1 + 3);
+    EXPECT_EQ(delta.destructions, 3);
+    EXPECT_EQ(delta.bytes_relocated, 3 * sizeof(Kitten));
+    auto copied = v;                 // 3 copies, allocate 1
+    EXPECT_EQ(scope.delta().copies, 1 + 3);
+    EXPECT_EQ(scope.delta().allocations, 4);
+  }
+  // everything is returned and destroyed:
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.deallocations, delta.allocations);
+  EXPECT_EQ(delta.destructions, 3 + 6);
+  // the counts of other types are not affected:
+  EXPECT_EQ(abc::stats_registry::get<abc::vector<int>>().allocations, 0);
+}
+TEST_F(TestStats, TriviallyRelocatable) {
+  using Vector = abc::vector<MoveOnly>;
+  auto scope = abc::stats_scope<Vector>();
+  auto v = Vector();
+  for (int i = 0; i != 8; ++i) {
+    v.emplace_back(i);
+  }
+  // relocated by bytes, neither moved nor destroyed:
+  auto delta = scope.delta();
+  EXPECT_EQ(delta.reallocations, 4);
+  EXPECT_EQ(delta.bytes_relocated, (1 + 2 + 4) * sizeof(MoveOnly));
+  EXPECT_EQ(delta.moves, 0);
+  EXPECT_EQ(delta.destructions, 0);
+}
+TEST_F(TestStats, SmallVector) {
+  using Vector = abc::small_vector<int, 8>;
+  auto scope = abc::stats_scope<Vector>();
+  auto v = Vector();
+  for (int i = 0; i != 8; ++i) {
+    v.emplace_back(i);
+  }
+  EXPECT_EQ(scope.delta().allocations, 0);
+  v.emplace_back(8);
+  EXPECT_EQ(scope.delta().allocations, 1);
+  EXPECT_EQ(scope.delta().reallocations, 1);
+}
+TEST_F(TestStats, ForwardList) {
+  using List = abc::forward_list<Kitten>;
+  auto scope = abc::stats_scope<List>();
+  {
+    auto list = List();
+    auto kitten = Kitten(0);
+    list.emplace_front(kitten);
+    list.emplace_front(abc::move(kitten));
+    list.emplace_front(2);
+    list.pop_front();
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.allocations, 3);
+    EXPECT_EQ(delta.deallocations, 1);
+    EXPECT_EQ(delta.copies, 1);
+    EXPECT_EQ(delta.moves, 1);
+    EXPECT_EQ(delta.destructions, 1);
+    EXPECT_EQ(delta.reallocations, 0);
+  }
+  EXPECT_EQ(scope.delta().deallocations, 3);
+}
+TEST_F(TestStats, Registry) {
+  abc::vector<double>().emplace_back(1.0);
+  auto found = false;
+  abc::stats_registry::for_each(
+      [&found](const std::type_info &type, const abc::container_stats &s) {
+        if (type == typeid(abc::vector<double>)) {
+          found = true;
+          EXPECT_EQ(s.allocations, 1);
+          EXPECT_EQ(s.deallocations, 1);
+        }
+      });
+  EXPECT_TRUE(found);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
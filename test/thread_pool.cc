@@ -0,0 +1,172 @@
+// Copyright 2026 Weicheng Pei
+#include "abc/thread_pool.h"
+
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <future>  // NOLINT
+#include <stdexcept>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "gtest/gtest.h"
+
+class TestThreadPool : public ::testing::Test {
+ protected:
+  abc::thread_pool pool{3};
+};
+TEST_F(TestThreadPool, Submit) {
+  EXPECT_EQ(pool.size(), 3);
+  auto futures = std::vector<std::future<int>>();
+  for (int i = 0; i != 100; ++i) {
+    futures.push_back(pool.submit([i] { return i * i; }));
+  }
+  for (int i = 0; i != 100; ++i) {
+    EXPECT_EQ(futures[i].get(), i * i);
+  }
+  // Exceptions are passed to the future:
+  auto future = pool.submit([]() -> int { throw std::runtime_error("oops"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+TEST_F(TestThreadPool, ParallelFor) {
+  for (std::size_t grain : {0, 1, 7, 1000}) {
+    auto hits = std::vector<std::atomic<int>>(1000);
+    pool.parallel_for(10, hits.size(), [&](std::size_t i) { ++hits[i]; },
+                      grain);
+    for (std::size_t i = 0; i != hits.size(); ++i) {
+      EXPECT_EQ(hits[i].load(), i >= 10);
+    }
+  }
+  pool.parallel_for(5, 5, [](std::size_t) { FAIL(); });
+}
+TEST_F(TestThreadPool, ParallelForThrows) {
+  auto calls = std::atomic<int>(0);
+  EXPECT_THROW(pool.parallel_for(0, 100, [&](std::size_t i) {
+    ++calls;
+    if (i == 42) {
+      throw std::out_of_range("42");
+    }
+  }, 1), std::out_of_range);
+  // The calls forked so far have returned, and the rest may be skipped:
+  EXPECT_LE(calls.load(), 100);
+  auto sum = std::atomic<int>(0);
+  pool.parallel_for(0, 100, [&](std::size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 4950);
+}
+TEST_F(TestThreadPool, NestedParallelFor) {
+  // Tasks of the pool may wait for nested loops, since callers help:
+  auto sum = std::atomic<int>(0);
+  pool.parallel_for(0, 8, [&](std::size_t) {
+    pool.parallel_for(0, 100, [&](std::size_t j) { sum += j; });
+  }, 1);
+  EXPECT_EQ(sum.load(), 8 * 4950);
+}
+static int Fib(abc::thread_pool *pool, int n) {
+  if (n < 2) {
+    return n;
+  }
+  int a, b;
+  pool->invoke([&] { a = Fib(pool, n - 1); }, [&] { b = Fib(pool, n - 2); });
+  return a + b;
+}
+TEST_F(TestThreadPool, Invoke) {
+  // From outside the pool, and recursively from its workers:
+  EXPECT_EQ(Fib(&pool, 20), 6765);
+  EXPECT_EQ(pool.submit([this] { return Fib(&pool, 18); }).get(), 2584);
+  // The forked call finishes before an exception leaves `invoke()`:
+  auto forked = std::atomic<bool>(false);
+  EXPECT_THROW(pool.invoke([] { throw std::out_of_range("f"); },
+                           [&] { forked = true; }), std::out_of_range);
+  EXPECT_TRUE(forked.load());
+  EXPECT_THROW(pool.invoke([] {}, [] { throw std::out_of_range("g"); }),
+               std::out_of_range);
+}
+TEST_F(TestThreadPool, Stealing) {
+  // Tasks forked by one worker can only meet if other workers steal them:
+  auto arrived = std::atomic<int>(0);
+  auto met = pool.submit([&] {
+    auto all = std::atomic<bool>(true);
+    pool.parallel_for(0, pool.size(), [&](std::size_t) {
+      ++arrived;
+      auto deadline = std::chrono::steady_clock::now() +
+                      std::chrono::seconds(10);
+      while (arrived.load() != static_cast<int>(pool.size())) {
+        if (std::chrono::steady_clock::now() > deadline) {
+          all = false;
+          return;
+        }
+        std::this_thread::yield();
+      }
+    }, 1);
+    return all.load();
+  });
+  EXPECT_TRUE(met.get());
+}
+TEST(TestChaseLevDeque, Sequential) {
+  // Grown past its capacity, it pops in LIFO order and steals in FIFO order:
+  auto deque = abc::internal::chase_lev_deque<int *>(2);
+  int items[10];
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+  for (auto &item : items) {
+    deque.push(&item);
+  }
+  EXPECT_FALSE(deque.empty());
+  EXPECT_EQ(deque.steal(), &items[0]);
+  EXPECT_EQ(deque.pop(), &items[9]);
+  EXPECT_EQ(deque.steal(), &items[1]);
+  for (int i = 8; i != 1; --i) {
+    EXPECT_EQ(deque.pop(), &items[i]);
+  }
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+}
+TEST(TestChaseLevDeque, Concurrent) {
+  // Every item is taken exactly once, either by the owner or by a thief:
+  constexpr int kSize = 100000;
+  auto deque = abc::internal::chase_lev_deque<int *>(4);
+  auto items = std::vector<int>(kSize);
+  auto taken = std::vector<std::atomic<int>>(kSize);
+  auto done = std::atomic<bool>(false);
+  auto take = [&](int *item) { ++taken[item - items.data()]; };
+  auto thieves = std::vector<std::thread>();
+  for (int i = 0; i != 3; ++i) {
+    thieves.emplace_back([&] {
+      while (!done.load() || !deque.empty()) {
+        if (auto *item = deque.steal()) {
+          take(item);
+        }
+      }
+    });
+  }
+  for (int i = 0; i != kSize; ++i) {
+    deque.push(&items[i]);
+    if (i % 3 == 0) {
+      if (auto *item = deque.pop()) {
+        take(item);
+      }
+    }
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  for (auto &count : taken) {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+TEST_F(TestThreadPool, Shutdown) {
+  // The destructor runs the submitted tasks before joining:
+  auto count = std::atomic<int>(0);
+  {
+    auto local = abc::thread_pool(2);
+    for (int i = 0; i != 100; ++i) {
+      local.submit([&] { ++count; });
+    }
+  }
+  EXPECT_EQ(count.load(), 100);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
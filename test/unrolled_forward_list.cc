@@ -0,0 +1,167 @@
+// Copyright 2026 Weicheng Pei
+
+#define ABC_ENABLE_STATS  // count allocations, see `NodesStayHalfFull`
+#include "abc/unrolled_forward_list.h"
+
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/data/stateful_allocator.h"
+#include "gtest/gtest.h"
+
+class TestUnrolledForwardList : public ::testing::Test {
+ protected:
+  using Kitten = abc::data::Copyable;
+  // A small capacity makes nodes split and merge often:
+  using List = abc::unrolled_forward_list<Kitten, 4>;
+  static List MakeList(std::initializer_list<int> ids) {
+    return List(ids.begin(), ids.end());
+  }
+  template <class L>
+  static std::vector<int> Ids(const L &list) {
+    auto ids = std::vector<int>();
+    for (auto &x : list) {
+      ids.push_back(x.Id());
+    }
+    return ids;
+  }
+};
+TEST_F(TestUnrolledForwardList, FrontOperations) {
+  auto list = List();
+  EXPECT_TRUE(list.empty());
+  for (int i = 0; i != 10; ++i) {
+    list.emplace_front(i);
+    EXPECT_EQ(list.front().Id(), i);
+  }
+  EXPECT_EQ(Ids(list), std::vector<int>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+  for (int i = 9; i >= 0; --i) {
+    EXPECT_EQ(list.front().Id(), i);
+    list.pop_front();
+  }
+  EXPECT_TRUE(list.empty());
+}
+TEST_F(TestUnrolledForwardList, EmplaceAfter) {
+  auto list = MakeList({0, 1, 2, 3, 4, 5, 6, 7, 8});
+  auto iter = std::next(list.begin(), 3);
+  iter = list.emplace_after(iter, 30);
+  EXPECT_EQ(iter->Id(), 30);
+  iter = list.emplace_after(iter, 31);
+  EXPECT_EQ(iter->Id(), 31);
+  EXPECT_EQ(std::next(iter)->Id(), 4);
+  iter = list.insert_after(list.before_begin(), {Kitten(-2), Kitten(-1)});
+  EXPECT_EQ(iter->Id(), -1);
+  EXPECT_EQ(Ids(list),
+            std::vector<int>({-2, -1, 0, 1, 2, 3, 30, 31, 4, 5, 6, 7, 8}));
+  iter = list.insert_after(std::next(list.begin(), 12), 2, Kitten(9));
+  EXPECT_EQ(std::next(iter), list.end());
+  EXPECT_EQ(Ids(list), std::vector<int>({-2, -1, 0, 1, 2, 3, 30, 31, 4, 5,
+                                         6, 7, 8, 9, 9}));
+}
+TEST_F(TestUnrolledForwardList, InsertOwnElement) {
+  // The element to copy is shifted within its node:
+  auto ints = abc::unrolled_forward_list<int, 8>{1, 2, 3};
+  ints.insert_after(ints.begin(), *std::next(ints.begin(), 2));
+  EXPECT_EQ(std::vector<int>(ints.begin(), ints.end()),
+            std::vector<int>({1, 3, 2, 3}));
+  // The element to copy is moved to a new node by splitting a full one:
+  auto list = MakeList({0, 1, 2, 3});
+  list.insert_after(list.begin(), *std::next(list.begin(), 3));
+  EXPECT_EQ(Ids(list), std::vector<int>({0, 3, 1, 2, 3}));
+  // The element to copy stays in the split node, but is shifted:
+  list = MakeList({0, 1, 2, 3});
+  list.insert_after(list.begin(), 2, *std::next(list.begin()));
+  EXPECT_EQ(Ids(list), std::vector<int>({0, 1, 1, 1, 2, 3}));
+}
+TEST_F(TestUnrolledForwardList, EraseAfter) {
+  auto list = MakeList({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  auto iter = list.erase_after(std::next(list.begin(), 2));
+  EXPECT_EQ(iter->Id(), 4);
+  iter = list.erase_after(list.before_begin());
+  EXPECT_EQ(iter->Id(), 1);
+  EXPECT_EQ(Ids(list), std::vector<int>({1, 2, 4, 5, 6, 7, 8, 9}));
+  iter = list.erase_after(list.begin(), std::next(list.begin(), 6));
+  EXPECT_EQ(iter->Id(), 8);
+  EXPECT_EQ(Ids(list), std::vector<int>({1, 8, 9}));
+  iter = list.erase_after(list.before_begin(), list.end());
+  EXPECT_EQ(iter, list.end());
+  EXPECT_TRUE(list.empty());
+}
+TEST_F(TestUnrolledForwardList, CopyAndMove) {
+  auto list = MakeList({0, 1, 2, 3, 4, 5, 6});
+  auto copied = list;
+  EXPECT_EQ(copied, list);
+  copied = MakeList({1});
+  EXPECT_NE(copied, list);
+  copied = list;
+  EXPECT_EQ(copied, list);
+  auto moved = std::move(copied);
+  EXPECT_EQ(moved, list);
+  EXPECT_TRUE(copied.empty());
+  copied = std::move(moved);
+  EXPECT_EQ(copied, list);
+  auto move_only = abc::unrolled_forward_list<abc::data::MoveOnly, 3>();
+  for (int i = 0; i != 10; ++i) {
+    move_only.emplace_front(i);
+  }
+  EXPECT_EQ(Ids(move_only), std::vector<int>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+}
+TEST_F(TestUnrolledForwardList, ThrowingConstructor) {
+  // Nothing is changed if the new element cannot be constructed:
+  auto list = MakeList({0, 1, 2, 3});
+  struct Bomb {
+    operator Kitten() const { throw std::runtime_error("bomb"); }  // NOLINT
+  };
+  EXPECT_THROW(list.emplace_after(std::next(list.begin()), Bomb()),
+               std::runtime_error);
+  EXPECT_EQ(Ids(list), std::vector<int>({0, 1, 2, 3}));
+}
+TEST_F(TestUnrolledForwardList, NodesStayHalfFull) {
+  // Random inserts and erases agree with std::forward_list, and every node
+  // but the last keeps at least half of its capacity:
+  using Allocator = abc::data::StatefulAllocator<int>;
+  using IntList = abc::unrolled_forward_list<int, 8, Allocator>;
+  auto alloc = Allocator();
+  auto list = IntList(alloc);
+  auto expected = std::forward_list<int>();
+  auto random = std::mt19937(42);
+  int size = 0;
+  for (int step = 0; step != 20000; ++step) {
+    auto pos = std::uniform_int_distribution<int>(0, size)(random);
+    auto abc_iter = std::next(list.before_begin(), pos);
+    auto std_iter = std::next(expected.before_begin(), pos);
+    if (pos < size && random() % 2) {
+      abc_iter = list.erase_after(abc_iter);
+      std_iter = expected.erase_after(std_iter);
+      --size;
+    } else {
+      abc_iter = list.emplace_after(abc_iter, step);
+      std_iter = expected.emplace_after(std_iter, step);
+      ++size;
+    }
+    ASSERT_EQ(abc_iter == list.end(), std_iter == expected.end());
+    if (std_iter != expected.end()) {
+      ASSERT_EQ(*abc_iter, *std_iter);
+    }
+  }
+  EXPECT_TRUE(std::equal(list.begin(), list.end(),
+                         expected.begin(), expected.end()));
+  // Each node takes at least `sizeof(int) * 8 / 2` bytes of elements:
+  auto nodes = (size + 3) / 4 + 1;
+  EXPECT_LE(alloc.Bytes(), nodes * (sizeof(int) * 8 + 2 * sizeof(void *)));
+  using Stats = abc::stats_scope<IntList>;
+  auto scope = Stats();
+  list.clear();
+  EXPECT_EQ(alloc.Bytes(), 0);
+  EXPECT_EQ(scope.delta().destructions, size);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,11 +1,17 @@
 // Copyright 2019 Minghao Yang and Weicheng Pei
+#define ABC_ENABLE_STATS  // count reallocations, see `Performance`
 #include "abc/vector.h"
 
 #include <algorithm>
-#include <chrono>  // NOLINT
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <sstream>
 #include <vector>
 
 #include "abc/data/copyable.h"
+#include "abc/data/move_only.h"
+#include "abc/data/stateful_allocator.h"
 #include "gtest/gtest.h"
 
 class TestVector : public ::testing::Test {
@@ -103,6 +109,27 @@ TEST_F(TestVector, Resize) {
   abc_vector_of_kitten.resize(0);
   ExpectEqual();
 }
+TEST_F(TestVector, ResizeAndOverwrite) {
+  using Vector = abc::vector<int>;
+  auto v = Vector{0, 1};
+  auto scope = abc::stats_scope<Vector>();
+  // The new elements are written by `op` only, which may keep fewer:
+  v.resize_and_overwrite(100, [](int *data, std::size_t count) {
+    for (std::size_t i = 2; i != count; ++i) {
+      data[i] = i;
+    }
+    return count - 10;
+  });
+  EXPECT_EQ(scope.delta().copies, 0);
+  EXPECT_EQ(scope.delta().reallocations, 1);
+  EXPECT_GE(v.capacity(), 100);
+  ASSERT_EQ(v.size(), 90);
+  for (int i = 0; i != 90; ++i) {
+    EXPECT_EQ(v[i], i);
+  }
+  v.resize_and_overwrite(3, [](int *, std::size_t count) { return count; });
+  EXPECT_EQ(v, Vector({0, 1, 2}));
+}
 TEST_F(TestVector, PopBack) {
   for (const auto& i : std_vector_of_id) {
     std_vector_of_kitten.emplace_back(i);
@@ -117,6 +144,215 @@ TEST_F(TestVector, PopBack) {
     abc_vector_of_kitten.pop_back();
   }
 }
+TEST_F(TestVector, ConstructorWithIterators) {
+  // (count, value) is not mistaken for (first, last):
+  auto filled = abc::vector<int>(5, 3);
+  EXPECT_EQ(filled, abc::vector<int>({3, 3, 3, 3, 3}));
+  // forward iterators:
+  auto list = std::forward_list<int>{1, 2, 3};
+  auto from_list = abc::vector<int>(list.begin(), list.end());
+  EXPECT_EQ(from_list, abc::vector<int>({1, 2, 3}));
+  EXPECT_EQ(from_list.capacity(), 3);
+  // input iterators:
+  auto input = std::istringstream("4 5 6 7");
+  auto from_input = abc::vector<int>(std::istream_iterator<int>(input),
+                                     std::istream_iterator<int>());
+  EXPECT_EQ(from_input, abc::vector<int>({4, 5, 6, 7}));
+}
+TEST_F(TestVector, Assign) {
+  for (auto count : {2, 4, 20}) {
+    for (int i = 0; i != 4; ++i) {
+      std_vector_of_kitten.emplace_back(i);
+      abc_vector_of_kitten.emplace_back(i);
+    }
+    std_vector_of_kitten.assign(count, std_vector_of_kitten.back());
+    abc_vector_of_kitten.assign(count, abc_vector_of_kitten.back());
+    EXPECT_TRUE(std::equal(abc_vector_of_kitten.begin(),
+                           abc_vector_of_kitten.end(),
+                           std_vector_of_kitten.begin(),
+                           std_vector_of_kitten.end()));
+  }
+  auto source = std::vector<Kitten>();
+  for (auto size : {3, 1, 8, 100, 0}) {
+    source.assign(size, Kitten(size));
+    abc_vector_of_kitten.assign(source.begin(), source.end());
+    EXPECT_TRUE(std::equal(abc_vector_of_kitten.begin(),
+                           abc_vector_of_kitten.end(),
+                           source.begin(), source.end()));
+  }
+  auto input = std::istringstream("1 2 3");
+  auto v = abc::vector<int>({9, 9, 9, 9});
+  v.assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  EXPECT_EQ(v, abc::vector<int>({1, 2, 3}));
+  v = {7, 8};
+  EXPECT_EQ(v, abc::vector<int>({7, 8}));
+}
+TEST_F(TestVector, Insert) {
+  auto abc_v = abc::vector<Kitten>({Kitten(0)});
+  auto std_v = std::vector<Kitten>({Kitten(0)});
+  auto expect_equal = [&abc_v, &std_v]() {
+    EXPECT_TRUE(std::equal(abc_v.begin(), abc_v.end(),
+                           std_v.begin(), std_v.end()));
+  };
+  auto source = std::vector<Kitten>();
+  for (int i = 0; i != 10; ++i) {
+    source.emplace_back(-i);
+  }
+  for (int i = 0; i != 8; ++i) {
+    auto index = i % (abc_v.size() + 1);
+    // a range at `index`:
+    auto abc_iter = abc_v.insert(abc_v.begin() + index,
+                                 source.begin(), source.begin() + i);
+    auto std_iter = std_v.insert(std_v.begin() + index,
+                                 source.begin(), source.begin() + i);
+    EXPECT_EQ(abc_iter - abc_v.begin(), std_iter - std_v.begin());
+    expect_equal();
+    // copies of an element at `index / 2`:
+    abc_v.insert(abc_v.begin() + index / 2, i, abc_v.back());
+    std_v.insert(std_v.begin() + index / 2, i, std_v.back());
+    expect_equal();
+    // a single element at the front:
+    abc_v.insert(abc_v.begin(), abc_v.back());
+    std_v.insert(std_v.begin(), std_v.back());
+    abc_v.emplace(abc_v.begin() + 1, i);
+    std_v.emplace(std_v.begin() + 1, i);
+    expect_equal();
+  }
+  // input iterators:
+  auto input = std::istringstream("1 2 3");
+  auto v = abc::vector<int>({0, 4});
+  auto iter = v.insert(v.begin() + 1, std::istream_iterator<int>(input),
+                       std::istream_iterator<int>());
+  EXPECT_EQ(iter, v.begin() + 1);
+  EXPECT_EQ(v, abc::vector<int>({0, 1, 2, 3, 4}));
+  v.insert(v.end(), {5, 6});
+  EXPECT_EQ(v, abc::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+}
+TEST_F(TestVector, Erase) {
+  for (int i = 0; i != 10; ++i) {
+    std_vector_of_kitten.emplace_back(i);
+    abc_vector_of_kitten.emplace_back(i);
+  }
+  auto abc_iter = abc_vector_of_kitten.erase(abc_vector_of_kitten.begin() + 2,
+                                             abc_vector_of_kitten.begin() + 5);
+  auto std_iter = std_vector_of_kitten.erase(std_vector_of_kitten.begin() + 2,
+                                             std_vector_of_kitten.begin() + 5);
+  EXPECT_EQ(*abc_iter, *std_iter);
+  abc_vector_of_kitten.erase(abc_vector_of_kitten.begin());
+  std_vector_of_kitten.erase(std_vector_of_kitten.begin());
+  abc_iter = abc_vector_of_kitten.erase(abc_vector_of_kitten.end() - 1);
+  std_vector_of_kitten.erase(std_vector_of_kitten.end() - 1);
+  EXPECT_EQ(abc_iter, abc_vector_of_kitten.end());
+  ExpectEqual();
+}
+TEST_F(TestVector, BulkOperationsReallocateOnce) {
+  using Vector = abc::vector<Kitten>;
+  auto list = std::forward_list<Kitten>();
+  for (int i = 0; i != 1000; ++i) {
+    list.emplace_front(i);
+  }
+  auto v = Vector({Kitten(-1), Kitten(-2)});
+  {
+    auto scope = abc::stats_scope<Vector>();
+    v.append_range(list);
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.reallocations, 1);
+    EXPECT_EQ(delta.copies, 1000);
+    EXPECT_EQ(delta.moves, 2);
+  }
+  {
+    // only the tail is moved:
+    v.reserve(v.size() + 10);
+    auto scope = abc::stats_scope<Vector>();
+    v.insert(v.end() - 3, 10, Kitten(0));
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.reallocations, 0);
+    EXPECT_EQ(delta.moves, 3);
+  }
+  EXPECT_EQ(v.size(), 1012);
+  EXPECT_EQ(v[2], list.front());
+}
+TEST_F(TestVector, PopBackDestroys) {
+  auto owner = std::make_shared<int>(0);
+  auto v = abc::vector<std::shared_ptr<int>>();
+  for (int i = 0; i != 10; ++i) {
+    v.push_back(owner);
+  }
+  v.pop_back();
+  EXPECT_EQ(owner.use_count(), 10);
+  v.resize(3);
+  EXPECT_EQ(owner.use_count(), 4);
+  v.clear();
+  EXPECT_EQ(owner.use_count(), 1);
+}
+TEST_F(TestVector, ReserveAndShrinkToFit) {
+  auto v = abc::vector<int>();
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_EQ(v.size(), 0);
+  auto data = v.data();
+  for (int i = 0; i != 100; ++i) {
+    v.emplace_back(i);
+  }
+  // no reallocation on the hot path:
+  EXPECT_EQ(v.data(), data);
+  v.reserve(10);  // no effect
+  EXPECT_EQ(v.capacity(), 100);
+  v.resize(10);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10);
+  for (int i = 0; i != 10; ++i) {
+    EXPECT_EQ(v[i], i);
+  }
+}
+TEST_F(TestVector, GrowthPolicy) {
+  // The default policy doubles the capacity, and shrinks with hysteresis:
+  auto v = abc::vector<int>();
+  for (int i = 0; i != 64; ++i) {
+    v.emplace_back(i);
+  }
+  EXPECT_EQ(v.capacity(), 64);
+  while (v.size() > 16) {
+    v.pop_back();
+  }
+  EXPECT_EQ(v.capacity(), 32);
+  auto data = v.data();
+  for (int i = 0; i != 100; ++i) {
+    v.emplace_back(i);
+    v.pop_back();
+    v.pop_back();
+    v.emplace_back(i);
+  }
+  EXPECT_EQ(v.data(), data);
+  // A policy growing by 3/2 that never shrinks:
+  using Policy = abc::no_shrink_growth_policy<3, 2>;
+  auto w = abc::vector<int, std::allocator<int>, Policy>();
+  auto capacities = std::vector<std::size_t>();
+  for (int i = 0; i != 20; ++i) {
+    w.emplace_back(i);
+    if (capacities.empty() || capacities.back() != w.capacity()) {
+      capacities.emplace_back(w.capacity());
+    }
+  }
+  EXPECT_EQ(capacities,
+            std::vector<std::size_t>({1, 2, 3, 4, 6, 9, 13, 19, 28}));
+  while (!w.empty()) {
+    w.pop_back();
+  }
+  EXPECT_EQ(w.capacity(), 28);
+  w.shrink_to_fit();
+  EXPECT_EQ(w.capacity(), 0);
+}
+TEST_F(TestVector, EmplaceBackAliasing) {
+  auto v = abc::vector<Kitten>();
+  v.emplace_back(1);
+  for (int i = 0; i != 100; ++i) {
+    v.push_back(v.front());
+  }
+  for (const auto &x : v) {
+    EXPECT_EQ(x, Kitten(1));
+  }
+}
 TEST_F(TestVector, At) {
   int j = 0;
   for (const auto& i : std_vector_of_id) {
@@ -180,6 +416,33 @@ TEST_F(TestVector, Equal) {
   EXPECT_FALSE(abc_vector_of_kitten != abc_vector_of_kitten);
   EXPECT_FALSE(new_vector_of_kitten != abc_vector_of_kitten);
 }
+TEST_F(TestVector, Compare) {
+  // Integers are compared by the vectorized kernels, with a tail:
+  auto std_a = std::vector<int>(), std_b = std::vector<int>();
+  for (int i = 0; i != 40; ++i) {
+    std_a.push_back(i);
+  }
+  std_b = std_a;
+  auto compare = [&]() {
+    auto a = abc::vector<int>(std_a.begin(), std_a.end());
+    auto b = abc::vector<int>(std_b.begin(), std_b.end());
+    EXPECT_EQ(a == b, std_a == std_b);
+    EXPECT_EQ(a != b, std_a != std_b);
+    EXPECT_EQ(a < b, std_a < std_b);
+    EXPECT_EQ(a > b, std_a > std_b);
+    EXPECT_EQ(a <= b, std_a <= std_b);
+    EXPECT_EQ(a >= b, std_a >= std_b);
+  };
+  compare();
+  std_b.pop_back();  // a proper prefix
+  compare();
+  std_b.push_back(-1);  // a smaller last element
+  compare();
+  std_b[3] = 100;  // a larger element in the first register
+  compare();
+  std_a.clear();
+  compare();
+}
 TEST_F(TestVector, Swap) {
   auto list_a = {1, 2, 3, 4};
   auto list_b = {5, 6};
@@ -197,20 +460,91 @@ TEST_F(TestVector, Swap) {
   EXPECT_EQ(b.capacity(), size_a);
   EXPECT_EQ(b.back(), end_of_a);
 }
+TEST_F(TestVector, Relocate) {
+  using MoveOnly = abc::data::MoveOnly;
+  static_assert(abc::is_trivially_relocatable_v<int>);
+  static_assert(abc::is_trivially_relocatable_v<MoveOnly>);
+  static_assert(!abc::is_trivially_relocatable_v<Kitten>);
+  // `MoveOnly`s are relocated by `std::memcpy`:
+  auto vector_of_move_only = abc::vector<MoveOnly>();
+  for (int i = 0; i != 100; ++i) {
+    vector_of_move_only.emplace_back(i);
+  }
+  for (int i = 0; i != 100; ++i) {
+    EXPECT_EQ(vector_of_move_only[i].Id(), i);
+  }
+  while (vector_of_move_only.size() > 1) {
+    vector_of_move_only.pop_back();
+    EXPECT_EQ(vector_of_move_only.back().Id(),
+              vector_of_move_only.size() - 1);
+  }
+  // `Kitten`s are relocated one by one:
+  for (auto i : std_vector_of_id) {
+    abc_vector_of_kitten.emplace_back(i);
+  }
+  abc_vector_of_kitten.resize(73, abc_vector_of_kitten.back());
+  EXPECT_EQ(abc_vector_of_kitten.back(), Kitten(std_vector_of_id.back()));
+}
+TEST_F(TestVector, StatefulAllocator) {
+  using Allocator = abc::data::StatefulAllocator<int>;
+  // A stateless allocator takes no space:
+  static_assert(sizeof(abc::vector<int>) == 3 * sizeof(void *));
+  auto alloc_a = Allocator(), alloc_b = Allocator();
+  {
+    auto b = abc::vector<int, Allocator>(alloc_b);
+    b.emplace_back(5);
+    EXPECT_EQ(alloc_a.Bytes(), 0);
+    EXPECT_EQ(alloc_b.Bytes(), b.capacity() * sizeof(int));
+    // Each vector owns a copy of its allocator:
+    auto c = abc::vector<int, Allocator>({1, 2, 3, 4}, alloc_a);
+    EXPECT_EQ(c.get_allocator(), alloc_a);
+    EXPECT_EQ(alloc_a.Bytes(), c.capacity() * sizeof(int));
+    // Copy assignment propagates the allocator:
+    b = c;
+    EXPECT_EQ(b.get_allocator(), alloc_a);
+    EXPECT_EQ(alloc_b.Bytes(), 0);
+    EXPECT_EQ(b, c);
+    // Swap propagates the allocators:
+    auto d = abc::vector<int, Allocator>({5, 6}, alloc_b);
+    b.swap(d);
+    EXPECT_EQ(b.get_allocator(), alloc_b);
+    EXPECT_EQ(d.get_allocator(), alloc_a);
+    // Move assignment propagates the allocator:
+    b = abc::move(d);
+    EXPECT_EQ(b.get_allocator(), alloc_a);
+    EXPECT_EQ(alloc_b.Bytes(), d.capacity() * sizeof(int));
+    EXPECT_EQ(b, c);
+  }
+  EXPECT_EQ(alloc_a.Bytes(), 0);
+  EXPECT_EQ(alloc_b.Bytes(), 0);
+}
 TEST_F(TestVector, Performance) {
-  using clock = std::chrono::high_resolution_clock;
-  auto ticks = [](auto& vector) {
-    auto start = clock::now();
-    for (int i = 0; i != 1000000; ++i) {
+  using Vector = decltype(abc_vector_of_kitten);
+  constexpr int kSize = 1 << 20;
+  {
+    // Each reallocation moves all existing elements:
+    auto scope = abc::stats_scope<Vector>();
+    for (int i = 0; i != kSize; ++i) {
+      abc_vector_of_kitten.emplace_back(i);
+    }
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.reallocations, 21);
+    EXPECT_EQ(delta.moves, kSize - 1);
+    EXPECT_EQ(delta.copies, 0);
+  }
+  {
+    // Nothing is reallocated after `reserve()`:
+    auto vector = Vector();
+    vector.reserve(kSize);
+    auto scope = abc::stats_scope<Vector>();
+    for (int i = 0; i != kSize; ++i) {
       vector.emplace_back(i);
     }
-    vector.clear();
-    std::chrono::duration<double> duration = clock::now() - start;
-    return duration.count();
-  };
-  auto t_std = ticks(std_vector_of_kitten);
-  auto t_abc = ticks(abc_vector_of_kitten);
-  EXPECT_LT(t_abc, t_std);
+    auto delta = scope.delta();
+    EXPECT_EQ(delta.allocations, 0);
+    EXPECT_EQ(delta.reallocations, 0);
+    EXPECT_EQ(delta.moves, 0);
+  }
 }
 
 int main(int argc, char* argv[]) {